@@ -0,0 +1,384 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "UEMeshAnimationWriter.h"
+#include "UEMeshBPExportFuncs.h"
+#include "UEMeshBPExportFuncsStats.h"
+
+static_assert(sizeof(FUEMeshBinaryAnimationHeader) == 32 && sizeof(FUEMeshBinaryAnimationChannel) == 36 && sizeof(FUEMeshBinaryAnimationTrack) == 112,
+	"Binary animation layout changed, bump FUEMeshBinaryAnimation::Version");
+
+#if WITH_EDITOR
+#include "Animation/AnimSequence.h"
+#include "Animation/Skeleton.h"
+#include "Animation/AnimData/IAnimationDataModel.h"
+#include "HAL/FileManager.h"
+#include "Templates/UniquePtr.h"
+#include "UEMeshJsonFileWriter.h"
+
+// Differences below this are sampling noise, a channel within it of its reference pose or first key is not animated
+static constexpr float MinKeyTolerance = 1.0e-3f;
+
+enum class EAnimationChannel : uint8
+{
+	Translation,
+	Rotation,
+	Scale
+};
+
+// Collects the data section of the file while the tracks are built
+struct FAnimationDataBuilder
+{
+	TArray<uint8> Data;
+
+	template <typename ValueType>
+	uint32 Append(const TArray<ValueType>& Values)
+	{
+		const int32 Offset = Align(Data.Num(), 4);
+		Data.AddZeroed(Offset - Data.Num());
+		Data.Append(reinterpret_cast<const uint8*>(Values.GetData()), Values.Num() * sizeof(ValueType));
+		return Offset;
+	}
+};
+
+// Helper function: Error of Value against Expected in the units of the key tolerance
+static float GetKeyError(EAnimationChannel Channel, const FVector4f& Value, const FVector4f& Expected)
+{
+	const FVector4f Difference = Value - Expected;
+	switch (Channel)
+	{
+	case EAnimationChannel::Translation:
+		return Difference.Size3();
+	case EAnimationChannel::Rotation:
+		// Angle of the rotation between the two, the sign of a quaternion does not change the rotation
+		return FMath::RadiansToDegrees(2.0f * FMath::Acos(FMath::Min(FMath::Abs(Dot4(Value, Expected)), 1.0f)));
+	default:
+		return FMath::Max3(FMath::Abs(Difference.X), FMath::Abs(Difference.Y), FMath::Abs(Difference.Z)) * 100.0f;
+	}
+}
+
+// Helper function: Value between two keys as a reader reconstructs it, rotations are normalized after the lerp
+static FVector4f InterpolateKeys(EAnimationChannel Channel, const FVector4f& A, const FVector4f& B, float Alpha)
+{
+	const FVector4f Value = A + (B - A) * Alpha;
+	if (Channel != EAnimationChannel::Rotation)
+	{
+		return Value;
+	}
+
+	const float Length = FMath::Sqrt(Dot4(Value, Value));
+	return Length > UE_SMALL_NUMBER ? Value * (1.0f / Length) : A;
+}
+
+// Helper function: Frames of the keys that reproduce every frame of Values within Tolerance, the first and last frame are always kept
+static void ReduceKeys(EAnimationChannel Channel, const TArray<FVector4f>& Values, float Tolerance, TArray<int32>& OutKeyFrames)
+{
+	OutKeyFrames.Add(0);
+
+	// A key is only needed where interpolating from the last kept key to the next frame misses a frame in between
+	int32 LastKey = 0;
+	for (int32 NextFrame = 2; NextFrame < Values.Num(); NextFrame++)
+	{
+		bool bCovered = true;
+		for (int32 Frame = LastKey + 1; Frame < NextFrame && bCovered; Frame++)
+		{
+			const float Alpha = float(Frame - LastKey) / float(NextFrame - LastKey);
+			bCovered = GetKeyError(Channel, Values[Frame], InterpolateKeys(Channel, Values[LastKey], Values[NextFrame], Alpha)) <= Tolerance;
+		}
+
+		if (!bCovered)
+		{
+			LastKey = NextFrame - 1;
+			OutKeyFrames.Add(LastKey);
+		}
+	}
+
+	if (Values.Num() > 1)
+	{
+		OutKeyFrames.Add(Values.Num() - 1);
+	}
+}
+
+// Helper function: Pick the keys of one channel, append their frames and values to the data section and describe them in OutChannel
+static void WriteChannel(EAnimationChannel Channel, const TArray<FVector4f>& Values, const FVector4f& RefValue, float KeyTolerance, bool bQuantize, bool b32BitFrames,
+	FAnimationDataBuilder& Builder, FUEMeshBinaryAnimationChannel& OutChannel)
+{
+	FMemory::Memzero(OutChannel);
+	OutChannel.FramesOffset = FUEMeshBinaryAnimation::InvalidOffset;
+	OutChannel.ValuesOffset = FUEMeshBinaryAnimation::InvalidOffset;
+
+	const float ConstantTolerance = FMath::Max(KeyTolerance, MinKeyTolerance);
+	bool bAtRefPose = true;
+	bool bConstant = true;
+	for (const FVector4f& Value : Values)
+	{
+		bAtRefPose = bAtRefPose && GetKeyError(Channel, Value, RefValue) <= ConstantTolerance;
+		bConstant = bConstant && GetKeyError(Channel, Value, Values[0]) <= ConstantTolerance;
+	}
+
+	if (bAtRefPose || Values.Num() == 0)
+	{
+		return;
+	}
+
+	TArray<int32> KeyFrames;
+	if (bConstant)
+	{
+		KeyFrames.Add(0);
+	}
+	else if (KeyTolerance > 0.0f)
+	{
+		ReduceKeys(Channel, Values, KeyTolerance, KeyFrames);
+	}
+	else
+	{
+		KeyFrames.SetNumUninitialized(Values.Num());
+		for (int32 Frame = 0; Frame < Values.Num(); Frame++)
+		{
+			KeyFrames[Frame] = Frame;
+		}
+	}
+
+	OutChannel.NumKeys = KeyFrames.Num();
+	if (KeyFrames.Num() < Values.Num())
+	{
+		if (b32BitFrames)
+		{
+			TArray<uint32> Frames(KeyFrames);
+			OutChannel.FramesOffset = Builder.Append(Frames);
+		}
+		else
+		{
+			TArray<uint16> Frames;
+			Frames.Reserve(KeyFrames.Num());
+			for (int32 Frame : KeyFrames)
+			{
+				Frames.Add((uint16)Frame);
+			}
+			OutChannel.FramesOffset = Builder.Append(Frames);
+		}
+	}
+
+	const int32 NumComponents = Channel == EAnimationChannel::Rotation ? 4 : 3;
+	if (!bQuantize)
+	{
+		TArray<float> Keys;
+		Keys.Reserve(KeyFrames.Num() * NumComponents);
+		for (int32 Frame : KeyFrames)
+		{
+			for (int32 Component = 0; Component < NumComponents; Component++)
+			{
+				Keys.Add(Values[Frame][Component]);
+			}
+		}
+		OutChannel.ValuesOffset = Builder.Append(Keys);
+	}
+	else if (Channel == EAnimationChannel::Rotation)
+	{
+		TArray<int16> Keys;
+		Keys.Reserve(KeyFrames.Num() * 4);
+		for (int32 Frame : KeyFrames)
+		{
+			for (int32 Component = 0; Component < 4; Component++)
+			{
+				Keys.Add((int16)FMath::RoundToInt(FMath::Clamp(Values[Frame][Component], -1.0f, 1.0f) * 32767.0f));
+			}
+		}
+		OutChannel.ValuesOffset = Builder.Append(Keys);
+	}
+	else
+	{
+		FVector3f Min(MAX_flt);
+		FVector3f Max(-MAX_flt);
+		for (int32 Frame : KeyFrames)
+		{
+			Min = FVector3f::Min(Min, FVector3f(Values[Frame]));
+			Max = FVector3f::Max(Max, FVector3f(Values[Frame]));
+		}
+		const FVector3f Extent = Max - Min;
+
+		TArray<uint16> Keys;
+		Keys.Reserve(KeyFrames.Num() * 3);
+		for (int32 Frame : KeyFrames)
+		{
+			for (int32 Component = 0; Component < 3; Component++)
+			{
+				const float Normalized = Extent[Component] > 0.0f ? (Values[Frame][Component] - Min[Component]) / Extent[Component] : 0.0f;
+				Keys.Add((uint16)FMath::RoundToInt(FMath::Clamp(Normalized, 0.0f, 1.0f) * 65535.0f));
+			}
+		}
+		for (int32 Component = 0; Component < 3; Component++)
+		{
+			OutChannel.Min[Component] = Min[Component];
+			OutChannel.Extent[Component] = Extent[Component];
+		}
+		OutChannel.ValuesOffset = Builder.Append(Keys);
+	}
+}
+
+bool WriteAnimationFile(UAnimSequence* Animation, float KeyTolerance, bool bQuantize, const FString& OutputPath, FUEMeshAnimationFileInfo& OutInfo)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UEMeshBPExport_WriteAnimationFile);
+
+	OutInfo = FUEMeshAnimationFileInfo();
+	const USkeleton* Skeleton = Animation ? Animation->GetSkeleton() : nullptr;
+	const IAnimationDataModel* DataModel = Animation ? Animation->GetDataModel() : nullptr;
+	if (!Skeleton || !DataModel || OutputPath.IsEmpty())
+	{
+		return false;
+	}
+
+	const FReferenceSkeleton& RefSkeleton = Skeleton->GetReferenceSkeleton();
+	const TArray<FTransform>& RefPose = RefSkeleton.GetRefBonePose();
+	const int32 NumFrames = DataModel->GetNumberOfKeys();
+	const bool b32BitFrames = NumFrames > (int32)MAX_uint16 + 1;
+
+	// Tracks in skeleton order, so a reader can apply them parents first
+	TArray<FName> TrackNames;
+	DataModel->GetBoneTrackNames(TrackNames);
+	TArray<TPair<int32, FName>> BoneTracks;
+	for (const FName& TrackName : TrackNames)
+	{
+		const int32 BoneIndex = RefSkeleton.FindBoneIndex(TrackName);
+		if (BoneIndex != INDEX_NONE)
+		{
+			BoneTracks.Emplace(BoneIndex, TrackName);
+		}
+	}
+	BoneTracks.Sort([](const TPair<int32, FName>& A, const TPair<int32, FName>& B) { return A.Key < B.Key; });
+
+	FAnimationDataBuilder Builder;
+	TArray<FUEMeshBinaryAnimationTrack> Tracks;
+	TArray<FTransform> Transforms;
+	TArray<FVector4f> Translations;
+	TArray<FVector4f> Rotations;
+	TArray<FVector4f> Scales;
+	for (const TPair<int32, FName>& BoneTrack : BoneTracks)
+	{
+		Transforms.Reset();
+		DataModel->GetBoneTrackTransforms(BoneTrack.Value, Transforms);
+		if (Transforms.Num() == 0)
+		{
+			continue;
+		}
+
+		Translations.Reset(Transforms.Num());
+		Rotations.Reset(Transforms.Num());
+		Scales.Reset(Transforms.Num());
+		for (const FTransform& Transform : Transforms)
+		{
+			const FQuat Rotation = Transform.GetRotation();
+			FVector4f RotationValue((float)Rotation.X, (float)Rotation.Y, (float)Rotation.Z, (float)Rotation.W);
+
+			// Neighbouring keys in the same hemisphere, otherwise interpolating between them takes the long way round
+			if (Rotations.Num() > 0 && Dot4(RotationValue, Rotations.Last()) < 0.0f)
+			{
+				RotationValue = RotationValue * -1.0f;
+			}
+
+			Translations.Emplace(FVector3f(Transform.GetTranslation()), 0.0f);
+			Rotations.Add(RotationValue);
+			Scales.Emplace(FVector3f(Transform.GetScale3D()), 0.0f);
+		}
+
+		const FTransform& RefTransform = RefPose[BoneTrack.Key];
+		const FQuat RefRotation = RefTransform.GetRotation();
+
+		FUEMeshBinaryAnimationTrack Track;
+		Track.BoneIndex = BoneTrack.Key;
+		WriteChannel(EAnimationChannel::Translation, Translations, FVector4f(FVector3f(RefTransform.GetTranslation()), 0.0f), KeyTolerance, bQuantize, b32BitFrames, Builder, Track.Translation);
+		WriteChannel(EAnimationChannel::Rotation, Rotations, FVector4f((float)RefRotation.X, (float)RefRotation.Y, (float)RefRotation.Z, (float)RefRotation.W), KeyTolerance, bQuantize, b32BitFrames, Builder, Track.Rotation);
+		WriteChannel(EAnimationChannel::Scale, Scales, FVector4f(FVector3f(RefTransform.GetScale3D()), 0.0f), KeyTolerance, bQuantize, b32BitFrames, Builder, Track.Scale);
+
+		// A bone that never leaves its reference pose costs nothing
+		const int32 NumTrackKeys = Track.Translation.NumKeys + Track.Rotation.NumKeys + Track.Scale.NumKeys;
+		if (NumTrackKeys > 0)
+		{
+			Tracks.Add(Track);
+			OutInfo.NumKeys += NumTrackKeys;
+		}
+	}
+
+	FUEMeshBinaryAnimationHeader Header;
+	Header.Magic = FUEMeshBinaryAnimation::Magic;
+	Header.Version = FUEMeshBinaryAnimation::Version;
+	Header.Flags = (bQuantize ? FUEMeshBinaryAnimation::FlagQuantized : 0) | (b32BitFrames ? FUEMeshBinaryAnimation::Flag32BitFrames : 0);
+	Header.NumFrames = NumFrames;
+	Header.FrameRate = (float)DataModel->GetFrameRate().AsDecimal();
+	Header.NumSkeletonBones = RefSkeleton.GetNum();
+	Header.NumTracks = Tracks.Num();
+	Header.DataSize = Builder.Data.Num();
+
+	TUniquePtr<FArchive> FileWriter(IFileManager::Get().CreateFileWriter(*OutputPath));
+	if (!FileWriter)
+	{
+		UE_LOG(LogUEMeshBPExport, Error, TEXT("Failed to export animation: %s"), *Animation->GetName());
+		return false;
+	}
+
+	FileWriter->Serialize(&Header, sizeof(Header));
+	FileWriter->Serialize(Tracks.GetData(), Tracks.Num() * sizeof(FUEMeshBinaryAnimationTrack));
+	FileWriter->Serialize(Builder.Data.GetData(), Builder.Data.Num());
+	if (!FileWriter->Close())
+	{
+		UE_LOG(LogUEMeshBPExport, Error, TEXT("Failed to export animation: %s"), *Animation->GetName());
+		return false;
+	}
+
+	OutInfo.NumFrames = NumFrames;
+	OutInfo.NumAnimatedBones = Tracks.Num();
+	UE_LOG(LogUEMeshBPExport, Log, TEXT("Exported animation to: %s (%d of %d bones animated, %d keys)"), *OutputPath, Tracks.Num(), RefSkeleton.GetNum(), OutInfo.NumKeys);
+	return true;
+}
+
+bool WriteSkeletonFile(const USkeleton* Skeleton, bool bCompactJson, const FString& OutputPath)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UEMeshBPExport_WriteSkeletonFile);
+
+	if (!Skeleton || OutputPath.IsEmpty())
+	{
+		return false;
+	}
+
+	const FReferenceSkeleton& RefSkeleton = Skeleton->GetReferenceSkeleton();
+	const bool bSaved = WriteJsonFile(OutputPath, bCompactJson, [&](auto& JsonWriter)
+	{
+		JsonWriter.WriteObjectStart();
+		JsonWriter.WriteValue(TEXT("SkeletonName"), Skeleton->GetName());
+		JsonWriter.WriteValue(TEXT("SkeletonAssetPath"), Skeleton->GetPathName());
+
+		// Reference pose in bone space, ten numbers per bone like the placements of the actor manifests
+		JsonWriter.WriteArrayStart(TEXT("Bones"));
+		for (int32 BoneIndex = 0; BoneIndex < RefSkeleton.GetNum(); BoneIndex++)
+		{
+			const FTransform& Transform = RefSkeleton.GetRefBonePose()[BoneIndex];
+			const FVector Location = Transform.GetLocation();
+			const FQuat Rotation = Transform.GetRotation();
+			const FVector Scale = Transform.GetScale3D();
+			const double Values[] = { Location.X, Location.Y, Location.Z, Rotation.X, Rotation.Y, Rotation.Z, Rotation.W, Scale.X, Scale.Y, Scale.Z };
+
+			JsonWriter.WriteObjectStart();
+			JsonWriter.WriteValue(TEXT("Name"), RefSkeleton.GetBoneName(BoneIndex).ToString());
+			JsonWriter.WriteValue(TEXT("ParentIndex"), RefSkeleton.GetParentIndex(BoneIndex));
+			JsonWriter.WriteArrayStart(TEXT("Transform"));
+			for (double Value : Values)
+			{
+				JsonWriter.WriteValue(Value);
+			}
+			JsonWriter.WriteArrayEnd();
+			JsonWriter.WriteObjectEnd();
+		}
+		JsonWriter.WriteArrayEnd();
+
+		JsonWriter.WriteObjectEnd();
+	});
+
+	if (!bSaved)
+	{
+		UE_LOG(LogUEMeshBPExport, Error, TEXT("Failed to export skeleton: %s"), *Skeleton->GetName());
+		return false;
+	}
+
+	UE_LOG(LogUEMeshBPExport, Log, TEXT("Exported skeleton to: %s"), *OutputPath);
+	return true;
+}
+#endif
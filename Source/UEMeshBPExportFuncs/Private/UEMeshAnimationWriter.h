@@ -0,0 +1,91 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/*
+*	Compact binary form of one animation sequence, stored as <Animation>.umba next to the other exported files.
+*
+*	Only bones whose local transform differs from the reference pose somewhere in the sequence get a track, every other
+*	bone of the skeleton stays in its reference pose (see the skeleton JSON written by WriteSkeletonFile). The size of
+*	the file and the work to load it therefore follow the animated bones, not the skeleton. All values are little-endian
+*	and every array starts 4-byte aligned:
+*
+*		Header
+*		Tracks		FUEMeshBinaryAnimationTrack[]	one per animated bone
+*		Data		uint8[]							frame indices and key values the channels point into
+*
+*	Each track holds a translation, a rotation and a scale channel. A channel with no keys is the reference pose, one key
+*	is constant for the whole sequence, otherwise its keys are linearly interpolated (rotations with normalized lerp).
+*	Frames lists the frame of every key as uint16 (uint32 with Flag32BitFrames) unless the channel has a key on every
+*	frame. Values are float3 for translation and scale and float4 (x, y, z, w) for rotation, or with FlagQuantized
+*	uint16 components mapping [0, 65535] onto [Min, Min + Extent] and int16 rotation components mapping [-32767, 32767]
+*	onto [-1, 1]. Translations are in centimeters, Unreal's axes and the skeleton's bone order are kept.
+*/
+
+struct FUEMeshBinaryAnimationHeader
+{
+	uint32 Magic = 0;
+	uint32 Version = 0;
+	uint32 Flags = 0;
+	uint32 NumFrames = 0;
+	float FrameRate = 0.0f;
+	/** Bones of the skeleton the track bone indices refer to */
+	uint32 NumSkeletonBones = 0;
+	uint32 NumTracks = 0;
+	/** Size of the data section behind the tracks */
+	uint32 DataSize = 0;
+};
+
+struct FUEMeshBinaryAnimationChannel
+{
+	uint32 NumKeys;
+	/** Offset into the data section, InvalidOffset if there is a key on every frame */
+	uint32 FramesOffset;
+	uint32 ValuesOffset;
+	/** Quantized translation and scale only */
+	float Min[3];
+	float Extent[3];
+};
+
+struct FUEMeshBinaryAnimationTrack
+{
+	/** Index of the bone in the reference skeleton of the skeleton asset */
+	uint32 BoneIndex;
+	FUEMeshBinaryAnimationChannel Translation;
+	FUEMeshBinaryAnimationChannel Rotation;
+	FUEMeshBinaryAnimationChannel Scale;
+};
+
+struct FUEMeshBinaryAnimation
+{
+	static constexpr uint32 Magic = 0x41424D55; // "UMBA"
+	static constexpr uint32 Version = 1;
+	static constexpr uint32 InvalidOffset = MAX_uint32;
+
+	static constexpr uint32 FlagQuantized = 1 << 0;
+	static constexpr uint32 Flag32BitFrames = 1 << 1;
+};
+
+#if WITH_EDITOR
+class UAnimSequence;
+class USkeleton;
+
+/** What WriteAnimationFile wrote, for the stats and the log */
+struct FUEMeshAnimationFileInfo
+{
+	int32 NumFrames = 0;
+	int32 NumAnimatedBones = 0;
+	int32 NumKeys = 0;
+};
+
+/**
+*	Samples the bone tracks of an animation sequence from its data model and writes them to OutputPath in the format above.
+*	KeyTolerance is the error a dropped key may introduce (centimeters, degrees and hundredths of scale), 0 keeps every frame.
+*/
+bool WriteAnimationFile(UAnimSequence* Animation, float KeyTolerance, bool bQuantize, const FString& OutputPath, FUEMeshAnimationFileInfo& OutInfo);
+
+/** Writes the bone names, parents and reference pose of a skeleton as JSON, the track bone indices of its animations index into it */
+bool WriteSkeletonFile(const USkeleton* Skeleton, bool bCompactJson, const FString& OutputPath);
+#endif
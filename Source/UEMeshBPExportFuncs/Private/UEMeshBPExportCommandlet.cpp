@@ -0,0 +1,207 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "UEMeshBPExportCommandlet.h"
+#include "UEMeshBPExportFuncs.h"
+#include "UEMeshBPExportFuncsBPLibrary.h"
+#include "UEMeshBPExportFuncsTypes.h"
+#include "UEMeshShardedExport.h"
+#include "UEMeshTextureHashIndex.h"
+
+#if WITH_EDITOR
+#include "Components/SkeletalMeshComponent.h"
+#include "Components/StaticMeshComponent.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "FileHelpers.h"
+#include "Materials/MaterialInterface.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "JsonObjectConverter.h"
+#endif
+
+UUEMeshBPExportCommandlet::UUEMeshBPExportCommandlet()
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = true;
+	LogToConsole = true;
+	ShowErrorCount = true;
+
+	HelpDescription = TEXT("Exports actors of maps and imports FBX directories as listed in a job file, and writes a JSON report");
+	HelpUsage = TEXT("UnrealEditor-Cmd <Project> -run=UEMeshBPExport -Job=<JobFile.json> [-Report=<ReportFile.json>] -nullrhi -unattended");
+	HelpParamNames.Add(TEXT("Job"));
+	HelpParamDescriptions.Add(TEXT("Path of the job file, an FUEMeshJob as JSON"));
+	HelpParamNames.Add(TEXT("Report"));
+	HelpParamDescriptions.Add(TEXT("Path of the report file, default <JobFile>.report.json"));
+}
+
+#if WITH_EDITOR
+// Helper function: Load the map of an export job and run ExportSkelMeshesBatch on the requested actors
+static void RunExportJob(const FUEMeshExportJob& Job, FUEMeshExportJobResult& OutResult)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UEMeshBPExport_CommandletExportJob);
+	
+	OutResult.Map = Job.Map;
+	OutResult.ExportPath = Job.ExportPath;
+	
+	UWorld* World = UEditorLoadingAndSavingUtils::LoadMap(Job.Map);
+	if (!World)
+	{
+		UE_LOG(LogUEMeshBPExport, Error, TEXT("UEMeshBPExport: Failed to load map %s"), *Job.Map);
+		return;
+	}
+	
+	TSet<FString> MissingActors(Job.Actors);
+	TArray<AActor*> Actors;
+	for (TActorIterator<AActor> It(World); It; ++It)
+	{
+		AActor* Actor = *It;
+		if (Job.Actors.Num() > 0)
+		{
+			// Labels are what artists see in the outliner, names are what scripts usually have
+			if (MissingActors.Remove(Actor->GetActorLabel()) > 0 || MissingActors.Remove(Actor->GetName()) > 0)
+			{
+				Actors.Add(Actor);
+			}
+		}
+		else if (Actor->FindComponentByClass<USkeletalMeshComponent>() || Actor->FindComponentByClass<UStaticMeshComponent>())
+		{
+			Actors.Add(Actor);
+		}
+	}
+	
+	OutResult.MissingActors = MissingActors.Array();
+	for (const FString& MissingActor : OutResult.MissingActors)
+	{
+		UE_LOG(LogUEMeshBPExport, Error, TEXT("UEMeshBPExport: Actor %s not found in %s"), *MissingActor, *Job.Map);
+	}
+	
+	const bool bExported = UUEMeshBPExportFuncsBPLibrary::ExportSkelMeshesBatch(Actors, Job.ExportPath, Job.Options, OutResult.Stats);
+	OutResult.NumActorsExported = Actors.Num();
+	OutResult.bSuccess = bExported && OutResult.MissingActors.Num() == 0;
+}
+
+// Helper function: Run ImportMeshes on the files of an import job
+static void RunImportJob(const FUEMeshImportJob& Job, FUEMeshImportJobResult& OutResult)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UEMeshBPExport_CommandletImportJob);
+	
+	OutResult.SourceDirectory = Job.SourceDirectory;
+	OutResult.TargetPath = Job.TargetPath;
+	
+	UMaterialInterface* ParentMaterial = nullptr;
+	if (Job.bImportMaterial)
+	{
+		ParentMaterial = LoadObject<UMaterialInterface>(nullptr, *Job.ParentMaterial);
+		if (!ParentMaterial)
+		{
+			UE_LOG(LogUEMeshBPExport, Error, TEXT("UEMeshBPExport: Parent material not found: %s"), *Job.ParentMaterial);
+			return;
+		}
+	}
+	
+	TArray<FString> Files = Job.Files;
+	if (Files.Num() == 0)
+	{
+		const FString SourceDirectory = Job.SourceDirectory / TEXT("");
+		for (const FUEMeshFileInfo& FileInfo : UUEMeshBPExportFuncsBPLibrary::ListFilesEx(Job.SourceDirectory, { TEXT("fbx") }, true, false))
+		{
+			FString RelativePath = FileInfo.Path;
+			FPaths::MakePathRelativeTo(RelativePath, *SourceDirectory);
+			Files.Add(MoveTemp(RelativePath));
+		}
+	}
+	
+	if (Files.Num() == 0)
+	{
+		UE_LOG(LogUEMeshBPExport, Warning, TEXT("UEMeshBPExport: No FBX files in %s"), *Job.SourceDirectory);
+		OutResult.bSuccess = true;
+		return;
+	}
+	
+	if (!Job.TextureHashIndexChangesFile.IsEmpty())
+	{
+		FUEMeshTextureHashIndex::SetChangesFile(Job.TextureHashIndexChangesFile);
+	}
+	
+	OutResult.Results = UUEMeshBPExportFuncsBPLibrary::ImportMeshes(Job.TargetPath, Job.SourceDirectory, Files,
+		Job.bImportMaterial, Job.bImportSkeleton, ParentMaterial, Job.Scale, OutResult.Stats, Job.SavePolicy, Job.SaveBatchSize, Job.MemoryBudgetMB, Job.NumWorkers);
+	
+	for (const FUEMeshImportResult& Result : OutResult.Results)
+	{
+		if (!Result.bSuccess)
+		{
+			OutResult.FailedFiles.Add(Result.MeshName);
+		}
+	}
+	OutResult.bSuccess = OutResult.FailedFiles.Num() == 0;
+}
+#endif
+
+int32 UUEMeshBPExportCommandlet::Main(const FString& Params)
+{
+#if WITH_EDITOR
+	const double StartTime = FPlatformTime::Seconds();
+	
+	FString JobPath;
+	if (!FParse::Value(*Params, TEXT("Job="), JobPath))
+	{
+		UE_LOG(LogUEMeshBPExport, Error, TEXT("UEMeshBPExport: Missing -Job=<JobFile.json>. Usage: %s"), *HelpUsage);
+		return 2;
+	}
+	
+	FString JobString;
+	FUEMeshJob Job;
+	if (!FFileHelper::LoadFileToString(JobString, *JobPath) || !FJsonObjectConverter::JsonObjectStringToUStruct(JobString, &Job, 0, 0))
+	{
+		UE_LOG(LogUEMeshBPExport, Error, TEXT("UEMeshBPExport: Failed to read job file %s"), *JobPath);
+		return 2;
+	}
+	
+	FString ReportPath = FPaths::GetBaseFilename(JobPath, false) + TEXT(".report.json");
+	FParse::Value(*Params, TEXT("Report="), ReportPath);
+	
+	FUEMeshJobReport Report;
+	Report.Job = JobPath;
+	
+	for (const FUEMeshExportJob& ExportJob : Job.Exports)
+	{
+		RunExportJob(ExportJob, Report.Exports.AddDefaulted_GetRef());
+		
+		// The map and everything the export loaded with it is released before the next job
+		CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+	}
+	
+	for (const FUEMeshExportShardJob& ShardJob : Job.ExportShards)
+	{
+		RunExportShard(ShardJob, Report.ExportShards.AddDefaulted_GetRef());
+	}
+	
+	for (const FUEMeshImportJob& ImportJob : Job.Imports)
+	{
+		RunImportJob(ImportJob, Report.Imports.AddDefaulted_GetRef());
+	}
+	
+	Report.bSuccess = !Report.Exports.ContainsByPredicate([](const FUEMeshExportJobResult& Result) { return !Result.bSuccess; })
+		&& !Report.ExportShards.ContainsByPredicate([](const FUEMeshExportShardResult& Result) { return !Result.bSuccess; })
+		&& !Report.Imports.ContainsByPredicate([](const FUEMeshImportJobResult& Result) { return !Result.bSuccess; });
+	Report.TotalSeconds = FPlatformTime::Seconds() - StartTime;
+	
+	FString ReportJson;
+	IFileManager::Get().MakeDirectory(*FPaths::GetPath(ReportPath), true);
+	if (!FJsonObjectConverter::UStructToJsonObjectString(Report, ReportJson) || !FFileHelper::SaveStringToFile(ReportJson, *ReportPath))
+	{
+		UE_LOG(LogUEMeshBPExport, Error, TEXT("UEMeshBPExport: Failed to write report %s"), *ReportPath);
+		return 1;
+	}
+	
+	UE_LOG(LogUEMeshBPExport, Display, TEXT("UEMeshBPExport: %d export and %d import jobs %s in %.2fs, report written to %s"),
+		Report.Exports.Num(), Report.Imports.Num(), Report.bSuccess ? TEXT("succeeded") : TEXT("failed"), Report.TotalSeconds, *ReportPath);
+	return Report.bSuccess ? 0 : 1;
+#else
+	UE_LOG(LogUEMeshBPExport, Error, TEXT("UEMeshBPExport: This commandlet is only available in editor builds"));
+	return 2;
+#endif
+}
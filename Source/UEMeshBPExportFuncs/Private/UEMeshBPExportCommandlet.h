@@ -0,0 +1,31 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "Commandlets/Commandlet.h"
+#include "UEMeshBPExportCommandlet.generated.h"
+
+/*
+*	Runs the export and import entry points unattended, e.g. on build farm nodes:
+*	UnrealEditor-Cmd <Project> -run=UEMeshBPExport -Job=<JobFile.json> [-Report=<ReportFile.json>] -nullrhi -unattended
+*
+*	The job file is an FUEMeshJob as JSON, keys are the property names:
+*	{
+*		"Exports": [ { "Map": "/Game/Maps/Characters", "Actors": [ "Hero" ], "ExportPath": "D:/Export", "Options": { "MeshFormat": "GLB" } } ],
+*		"Imports": [ { "SourceDirectory": "D:/Export", "TargetPath": "/Game/Imported", "ParentMaterial": "/Game/M_Base.M_Base" } ]
+*	}
+*	Exports run before imports, so one job can round-trip a data set. "NumWorkers" in the export options spreads an
+*	export over that many further commandlet processes, see UEMeshShardedExport.h, and "NumWorkers" of an import
+*	entry does the same for the import, see ImportMeshes. The FUEMeshJobReport is written to the report file
+*	(default <JobFile>.report.json). Exit code 0 if every job succeeded, 1 if any failed, 2 if the job file is unusable.
+*/
+UCLASS()
+class UUEMeshBPExportCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UUEMeshBPExportCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+};
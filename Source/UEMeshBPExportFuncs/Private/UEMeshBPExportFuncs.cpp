@@ -1,9 +1,23 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "UEMeshBPExportFuncs.h"
+#include "UEMeshBPExportFuncsStats.h"
 
 #define LOCTEXT_NAMESPACE "FUEMeshBPExportFuncsModule"
 
+DEFINE_LOG_CATEGORY(LogUEMeshBPExport);
+
+DEFINE_STAT(STAT_UEMeshBPExport_MeshesExported);
+DEFINE_STAT(STAT_UEMeshBPExport_MaterialsExported);
+DEFINE_STAT(STAT_UEMeshBPExport_TexturesExported);
+DEFINE_STAT(STAT_UEMeshBPExport_CacheHits);
+DEFINE_STAT(STAT_UEMeshBPExport_CacheMisses);
+DEFINE_STAT(STAT_UEMeshBPExport_BytesWritten);
+DEFINE_STAT(STAT_UEMeshBPExport_MeshesImported);
+DEFINE_STAT(STAT_UEMeshBPExport_TexturesImported);
+DEFINE_STAT(STAT_UEMeshBPExport_MaterialInstancesCreated);
+DEFINE_STAT(STAT_UEMeshBPExport_BytesRead);
+
 void FUEMeshBPExportFuncsModule::StartupModule()
 {
 	// This code will execute after your module is loaded into memory; the exact timing is specified in the .uplugin file per-module
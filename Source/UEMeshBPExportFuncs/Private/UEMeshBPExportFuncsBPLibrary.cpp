@@ -2,6 +2,15 @@
 
 #include "UEMeshBPExportFuncsBPLibrary.h"
 #include "UEMeshBPExportFuncs.h"
+#include "UEMeshBPExportFuncsStats.h"
+#include "UEMeshExportSession.h"
+#include "UEMeshBinaryManifest.h"
+#include "UEMeshBenchmark.h"
+#include "UEMeshDirectoryScanner.h"
+#include "UEMeshTextureHashIndex.h"
+#include "UEMeshImportSaver.h"
+#include "UEMeshShardedExport.h"
+#include "UEMeshWorkerProcess.h"
 
 #if WITH_EDITOR
 #include "AssetExportTask.h"
@@ -40,605 +49,806 @@
 #include "Engine/StaticMesh.h"
 #include "AssetRegistry/AssetRegistryModule.h"
 #include "UObject/SavePackage.h"
+#include "UObject/UObjectIterator.h"
+#include "PackageTools.h"
+#include "Editor.h"
+#include "Subsystems/ImportSubsystem.h"
+#include "HAL/PlatformTime.h"
+#include "Async/ParallelFor.h"
+#include "Misc/ScopedSlowTask.h"
+#include "ImageCore.h"
+#include "EditorFramework/AssetImportData.h"
 #endif
 
+#define LOCTEXT_NAMESPACE "UEMeshBPExportFuncsBPLibrary"
+
 UUEMeshBPExportFuncsBPLibrary::UUEMeshBPExportFuncsBPLibrary(const FObjectInitializer& ObjectInitializer)
 : Super(ObjectInitializer)
 {
 
 }
 
-#if WITH_EDITOR
-// Helper function: Get relative path from /Game
-static FString GetRelativePathFromGame(const FString& AssetPath)
+bool UUEMeshBPExportFuncsBPLibrary::ExportSkelMeshes(AActor* Actor, const FString& ExportName, const FString& ExportPath)
 {
-	FString RelativePath = AssetPath;
+#if WITH_EDITOR
+	if (!Actor)
+	{
+		UE_LOG(LogUEMeshBPExport, Error, TEXT("ExportSkelMeshes: Actor is null"));
+		return false;
+	}
 	
-	// Remove package name suffix (e.g., "/Game/MyAsset.MyAsset" -> "/Game/MyAsset")
-	int32 DotIndex;
-	if (RelativePath.FindLastChar('.', DotIndex))
+	if (ExportPath.IsEmpty())
 	{
-		RelativePath = RelativePath.Left(DotIndex);
+		UE_LOG(LogUEMeshBPExport, Error, TEXT("ExportSkelMeshes: ExportPath is empty"));
+		return false;
 	}
 	
-	// Remove /Game prefix
-	if (RelativePath.StartsWith(TEXT("/Game/")))
+	FUEMeshExportSession Session(ExportPath, FUEMeshExportOptions());
+	if (!Session.Initialize())
 	{
-		RelativePath = RelativePath.RightChop(6); // Remove "/Game/"
+		return false;
 	}
 	
-	return RelativePath;
+	bool bSuccess = Session.ExportActor(Actor, ExportName);
+	Session.Finish();
+	
+	return bSuccess;
+	
+#else
+	UE_LOG(LogUEMeshBPExport, Error, TEXT("ExportSkelMeshes: This function is only available in Editor"));
+	return false;
+#endif
 }
 
-// Helper function: Export texture to PNG
-static bool ExportTextureToPNG(UTexture2D* Texture, const FString& OutputPath)
+bool UUEMeshBPExportFuncsBPLibrary::ExportSkelMeshesBatch(const TArray<AActor*>& Actors, const FString& ExportPath, const FUEMeshExportOptions& Options, FUEMeshExportStats& OutStats)
 {
-	if (!Texture || OutputPath.IsEmpty())
+	OutStats = FUEMeshExportStats();
+	
+#if WITH_EDITOR
+	if (ExportPath.IsEmpty())
 	{
+		UE_LOG(LogUEMeshBPExport, Error, TEXT("ExportSkelMeshesBatch: ExportPath is empty"));
 		return false;
 	}
 	
-	// Check if file already exists
-	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
-	if (PlatformFile.FileExists(*OutputPath))
+	if (Options.NumWorkers > 1)
 	{
-		UE_LOG(LogTemp, Log, TEXT("Texture PNG already exists, skipping: %s"), *OutputPath);
-		return true;
+		return ExportSkelMeshesSharded(Actors, ExportPath, Options, OutStats);
 	}
 	
-	// Export using UAssetExportTask
-	UAssetExportTask* ExportTask = NewObject<UAssetExportTask>();
-	ExportTask->Object = Texture;
-	ExportTask->Exporter = nullptr;
-	ExportTask->Filename = OutputPath;
-	ExportTask->bSelected = false;
-	ExportTask->bReplaceIdentical = false;
-	ExportTask->bPrompt = false;
-	ExportTask->bUseFileArchive = false;
-	ExportTask->bWriteEmptyFiles = false;
-	
-	bool bSuccess = UExporter::RunAssetExportTask(ExportTask);
+	FUEMeshExportSession Session(ExportPath, Options);
+	if (!Session.Initialize())
+	{
+		return false;
+	}
 	
-	if (bSuccess && ExportTask->Errors.Num() == 0)
+	// One session for the whole batch, shared meshes/materials/textures are exported only once
+	bool bAllSucceeded = true;
+	for (AActor* Actor : Actors)
 	{
-		UE_LOG(LogTemp, Log, TEXT("Exported texture to: %s"), *OutputPath);
-		return true;
+		if (!Actor)
+		{
+			UE_LOG(LogUEMeshBPExport, Warning, TEXT("ExportSkelMeshesBatch: Skipping null actor"));
+			bAllSucceeded = false;
+			continue;
+		}
+		
+		if (!Session.ExportActor(Actor, Actor->GetName()))
+		{
+			bAllSucceeded = false;
+		}
 	}
-	else
+	
+	// Sequences no actor plays, those already exported with an actor are reused
+	if (Options.bExportAnimations)
 	{
-		UE_LOG(LogTemp, Error, TEXT("Failed to export texture: %s"), *Texture->GetName());
-		return false;
+		for (UAnimSequence* Animation : Options.Animations)
+		{
+			if (!Session.ExportAnimation(Animation))
+			{
+				bAllSucceeded = false;
+			}
+		}
 	}
+	
+	Session.Finish();
+	OutStats = Session.GetStats();
+	
+	return bAllSucceeded;
+	
+#else
+	UE_LOG(LogUEMeshBPExport, Error, TEXT("ExportSkelMeshesBatch: This function is only available in Editor"));
+	return false;
+#endif
 }
 
-// Helper function: Export skeletal mesh to FBX
-static bool ExportSkeletalMeshToFBX(USkeletalMesh* SkeletalMesh, const FString& OutputPath)
+TArray<FString> UUEMeshBPExportFuncsBPLibrary::ListFiles(const FString& Path, const FString& FilterString, bool bRecursive)
 {
-	if (!SkeletalMesh || OutputPath.IsEmpty())
-	{
-		return false;
-	}
+	TArray<FString> Result;
 	
-	// Check if file already exists
-	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
-	if (PlatformFile.FileExists(*OutputPath))
+	// Check if path exists
+	if (!FPaths::DirectoryExists(Path))
 	{
-		UE_LOG(LogTemp, Log, TEXT("FBX already exists, skipping: %s"), *OutputPath);
-		return true;
+		UE_LOG(LogUEMeshBPExport, Warning, TEXT("ListFiles: Directory does not exist: %s"), *Path);
+		return Result;
 	}
 	
-	// Export using UAssetExportTask
-	UAssetExportTask* ExportTask = NewObject<UAssetExportTask>();
-	ExportTask->Object = SkeletalMesh;
-	ExportTask->Exporter = nullptr;
-	ExportTask->Filename = OutputPath;
-	ExportTask->bSelected = false;
-	ExportTask->bReplaceIdentical = false;
-	ExportTask->bPrompt = false;
-	ExportTask->bUseFileArchive = false;
-	ExportTask->bWriteEmptyFiles = false;
-	ExportTask->bAutomated = true;
-	
-	UFbxExportOption* FbxOptions = NewObject<UFbxExportOption>();
-	FbxOptions->bExportMorphTargets = false;
-	FbxOptions->bExportPreviewMesh = false;
-	FbxOptions->bExportLocalTime = false;
-	FbxOptions->bForceFrontXAxis = false;
-	FbxOptions->Collision = false;
-	FbxOptions->LevelOfDetail = false;
-
-	ExportTask->Options = FbxOptions;
+	// Prepare search pattern
+	FString SearchPattern = FilterString.IsEmpty() ? TEXT("*.*") : FilterString;
+	FString FullSearchPath = FPaths::Combine(Path, SearchPattern);
 	
-	bool bSuccess = UExporter::RunAssetExportTask(ExportTask);
+	// Find files in current directory
+	IFileManager& FileManager = IFileManager::Get();
 	
-	if (bSuccess && ExportTask->Errors.Num() == 0)
+	if (bRecursive)
 	{
-		UE_LOG(LogTemp, Log, TEXT("Exported skeletal mesh to: %s"), *OutputPath);
-		return true;
+		// Recursive search
+		FileManager.FindFilesRecursive(Result, *Path, *SearchPattern, true, false);
 	}
 	else
 	{
-		UE_LOG(LogTemp, Error, TEXT("Failed to export skeletal mesh: %s"), *SkeletalMesh->GetName());
-		return false;
+		// Non-recursive search
+		TArray<FString> FoundFiles;
+		FileManager.FindFiles(FoundFiles, *FullSearchPath, true, false);
+		
+		// Convert relative paths to full paths
+		for (const FString& FileName : FoundFiles)
+		{
+			Result.Add(FPaths::Combine(Path, FileName));
+		}
 	}
+	
+	return Result;
 }
 
-// Helper function: Collect and export material parameters
-static FString ExportMaterialToJSON(UMaterialInterface* Material, const FString& ExportBasePath, TSet<UTexture*>& ProcessedTextures)
+TArray<FUEMeshFileInfo> UUEMeshBPExportFuncsBPLibrary::ListFilesEx(const FString& Path, const TArray<FString>& Extensions, bool bRecursive, bool bUseCache)
 {
-	if (!Material)
+	TArray<FUEMeshFileInfo> Result;
+	
+	if (!FPaths::DirectoryExists(Path))
 	{
-		return FString();
+		UE_LOG(LogUEMeshBPExport, Warning, TEXT("ListFilesEx: Directory does not exist: %s"), *Path);
+		return Result;
 	}
 	
-	// Check if material JSON already exists
-	FString MaterialRelativePath = GetRelativePathFromGame(Material->GetPathName());
-	FString MaterialJsonPath = FPaths::Combine(ExportBasePath, MaterialRelativePath + TEXT("_material.json"));
+	FUEMeshDirectoryScanner::Scan(Path, Extensions, bRecursive, bUseCache, Result);
+	return Result;
+}
+
+void UUEMeshBPExportFuncsBPLibrary::ClearListFilesCache()
+{
+	FUEMeshDirectoryScanner::ClearCache();
+}
+
+#if WITH_EDITOR
+// Texture file read, hashed and decoded ahead of time by PrefetchTextures
+struct FPrefetchedTexture
+{
+	FImage Image;
+	bool bDecoded = false;
+	/** Only kept for formats ImageWrapper cannot decode, they are imported by UTextureFactory */
+	TArray64<uint8> FileData;
+	bool bLoaded = false;
+	/** Hash of the file bytes, see FUEMeshTextureHashIndex */
+	uint64 FileHash = 0;
+	bool bHashed = false;
+};
+
+typedef TMap<FString, FPrefetchedTexture> FTexturePrefetchMap;
+
+// Objects modified while binding materials. Their PostEditChange runs once per object at the end of
+// ImportMaterialFromJson instead of once per slot, so a mesh is rebuilt once no matter how many slots it has.
+struct FDeferredMaterialRebuilds
+{
+	TSet<UTexture*> Textures;
+	TSet<UMaterialInstanceConstant*> MaterialInstances;
+	TSet<UObject*> Meshes;
 	
-	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
-	if (PlatformFile.FileExists(*MaterialJsonPath))
+	int32 Num() const
 	{
-		return MaterialRelativePath + TEXT("_material.json");
+		return Textures.Num() + MaterialInstances.Num() + Meshes.Num();
 	}
-	
-	TSharedPtr<FJsonObject> MaterialJson = MakeShareable(new FJsonObject);
-	MaterialJson->SetStringField(TEXT("MaterialName"), Material->GetName());
-	MaterialJson->SetStringField(TEXT("MaterialAssetPath"), Material->GetPathName());
-	
-	// Collect scalar parameters
-	TArray<FMaterialParameterInfo> ScalarParameterInfos;
-	TArray<FGuid> ScalarParameterIds;
-	Material->GetAllScalarParameterInfo(ScalarParameterInfos, ScalarParameterIds);
-	
-	TArray<TSharedPtr<FJsonValue>> ScalarParamsArray;
-	for (const FMaterialParameterInfo& ParamInfo : ScalarParameterInfos)
+};
+
+// Helper function: Normalize a texture path from the material JSON
+static FString NormalizeTexturePath(const FString& TexturePath)
+{
+	return TexturePath.Replace(TEXT("\\"), TEXT("/"));
+}
+
+// Helper function: Get the content path a texture file is imported into
+static FString GetTextureDestinationPath(const FString& TexturePath, const FString& _TargetUEPath, const FString& SourceFbxPath)
+{
+	// Extract relative path from absolute path
+	FString SourceRoot = SourceFbxPath.EndsWith(TEXT("/")) ? SourceFbxPath : SourceFbxPath + TEXT("/");
+	FString RelativePath = TexturePath;
+	int32 GameIndex = RelativePath.Find(SourceRoot, ESearchCase::IgnoreCase);
+	if (GameIndex != INDEX_NONE)
 	{
-		float ParamValue = 0.0f;
-		if (Material->GetScalarParameterValue(ParamInfo, ParamValue))
-		{
-			TSharedPtr<FJsonObject> ParamJson = MakeShareable(new FJsonObject);
-			ParamJson->SetStringField(TEXT("Name"), ParamInfo.Name.ToString());
-			ParamJson->SetNumberField(TEXT("Value"), ParamValue);
-			ScalarParamsArray.Add(MakeShareable(new FJsonValueObject(ParamJson)));
-		}
+		RelativePath = RelativePath.RightChop(GameIndex + SourceRoot.Len());
+		RelativePath = FPaths::GetPath(RelativePath);
+	}
+	else
+	{
+		RelativePath = FPaths::GetPath(FPaths::GetBaseFilename(TexturePath));
 	}
-	MaterialJson->SetArrayField(TEXT("ScalarParameters"), ScalarParamsArray);
-	
-	// Collect vector parameters
-	TArray<FMaterialParameterInfo> VectorParameterInfos;
-	TArray<FGuid> VectorParameterIds;
-	Material->GetAllVectorParameterInfo(VectorParameterInfos, VectorParameterIds);
 	
-	TArray<TSharedPtr<FJsonValue>> VectorParamsArray;
-	for (const FMaterialParameterInfo& ParamInfo : VectorParameterInfos)
+	FString TargetUEPath = _TargetUEPath.EndsWith(TEXT("/")) ? _TargetUEPath : _TargetUEPath + TEXT("/");
+	return TargetUEPath + RelativePath;
+}
+
+// Helper function: Find a texture that was already imported into DestinationPath
+static UTexture2D* FindImportedTexture(const FString& FilePath, const FString& DestinationPath)
+{
+	FString TextureName = FPaths::GetBaseFilename(FilePath);
+	UPackage* ExistingPackage = FindPackage(nullptr, *(DestinationPath / TextureName));
+	return ExistingPackage ? FindObject<UTexture2D>(ExistingPackage, *TextureName) : nullptr;
+}
+
+// Helper function: Read, hash and decode texture files on worker threads
+static void PrefetchTextures(const TArray<FString>& FilePaths, FTexturePrefetchMap& OutTextures, FUEMeshImportStats& Stats)
+{
+	if (FilePaths.Num() == 0)
 	{
-		FLinearColor ParamValue;
-		if (Material->GetVectorParameterValue(ParamInfo, ParamValue))
-		{
-			TSharedPtr<FJsonObject> ParamJson = MakeShareable(new FJsonObject);
-			ParamJson->SetStringField(TEXT("Name"), ParamInfo.Name.ToString());
-			
-			TSharedPtr<FJsonObject> ColorJson = MakeShareable(new FJsonObject);
-			ColorJson->SetNumberField(TEXT("R"), ParamValue.R);
-			ColorJson->SetNumberField(TEXT("G"), ParamValue.G);
-			ColorJson->SetNumberField(TEXT("B"), ParamValue.B);
-			ColorJson->SetNumberField(TEXT("A"), ParamValue.A);
-			ParamJson->SetObjectField(TEXT("Value"), ColorJson);
-			
-			VectorParamsArray.Add(MakeShareable(new FJsonValueObject(ParamJson)));
-		}
+		return;
 	}
-	MaterialJson->SetArrayField(TEXT("VectorParameters"), VectorParamsArray);
 	
-	// Collect texture parameters
-	TArray<FMaterialParameterInfo> TextureParameterInfos;
-	TArray<FGuid> TextureParameterIds;
-	Material->GetAllTextureParameterInfo(TextureParameterInfos, TextureParameterIds);
+	TRACE_CPUPROFILER_EVENT_SCOPE(UEMeshBPExport_PrefetchTextures);
+	const double PrefetchStartTime = FPlatformTime::Seconds();
+	
+	IImageWrapperModule& ImageWrapperModule = FModuleManager::LoadModuleChecked<IImageWrapperModule>(FName("ImageWrapper"));
+	FUEMeshTextureHashIndex::EnsureLoaded();
+	
+	TArray<FPrefetchedTexture> Prefetched;
+	Prefetched.SetNum(FilePaths.Num());
+	TArray<int64> FileSizes;
+	FileSizes.SetNumZeroed(FilePaths.Num());
 	
-	TArray<TSharedPtr<FJsonValue>> TextureParamsArray;
-	for (const FMaterialParameterInfo& ParamInfo : TextureParameterInfos)
+	ParallelFor(FilePaths.Num(), [&FilePaths, &Prefetched, &FileSizes, &ImageWrapperModule](int32 Index)
 	{
-		UTexture* ParamTexture = nullptr;
-		if (Material->GetTextureParameterValue(ParamInfo, ParamTexture) && ParamTexture)
+		TRACE_CPUPROFILER_EVENT_SCOPE(UEMeshBPExport_DecodeTexture);
+		FPrefetchedTexture& Texture = Prefetched[Index];
+		if (FFileHelper::LoadFileToArray(Texture.FileData, *FilePaths[Index]))
 		{
-			UTexture2D* Texture2D = Cast<UTexture2D>(ParamTexture);
-			if (Texture2D)
+			FileSizes[Index] = Texture.FileData.Num();
+			Texture.FileHash = FUEMeshTextureHashIndex::HashFileData(Texture.FileData.GetData(), Texture.FileData.Num());
+			Texture.bHashed = true;
+			Texture.bLoaded = true;
+			
+			// Bytes imported before are most likely resolved to that texture, decoding them would be wasted
+			if (FUEMeshTextureHashIndex::Contains(Texture.FileHash))
 			{
-				TSharedPtr<FJsonObject> TextureJson = MakeShareable(new FJsonObject);
-				TextureJson->SetStringField(TEXT("ParameterName"), ParamInfo.Name.ToString());
-				TextureJson->SetStringField(TEXT("TextureAssetPath"), Texture2D->GetPathName());
-				
-				// Get relative path and construct export path
-				FString TextureRelativePath = GetRelativePathFromGame(Texture2D->GetPathName());
-				FString TexturePNGPath = FPaths::Combine(ExportBasePath, TextureRelativePath + TEXT(".png"));
-				
-				// Ensure directory exists
-				FString TextureDir = FPaths::GetPath(TexturePNGPath);
-				if (!PlatformFile.DirectoryExists(*TextureDir))
-				{
-					PlatformFile.CreateDirectoryTree(*TextureDir);
-				}
-				
-				// Export texture if not already processed
-				if (!ProcessedTextures.Contains(Texture2D))
-				{
-					ExportTextureToPNG(Texture2D, TexturePNGPath);
-					ProcessedTextures.Add(Texture2D);
-				}
-				
-				// Store relative path in JSON
-				TextureJson->SetStringField(TEXT("ExportedPNGPath"), TextureRelativePath + TEXT(".png"));
-				
-				TextureParamsArray.Add(MakeShareable(new FJsonValueObject(TextureJson)));
+				Texture.FileData.Empty();
+				Texture.bLoaded = false;
+			}
+			else if (ImageWrapperModule.DecompressImage(Texture.FileData.GetData(), Texture.FileData.Num(), Texture.Image))
+			{
+				Texture.bDecoded = true;
+				Texture.FileData.Empty();
+				Texture.bLoaded = false;
 			}
 		}
+	});
+	
+	OutTextures.Reserve(OutTextures.Num() + FilePaths.Num());
+	for (int32 Index = 0; Index < FilePaths.Num(); Index++)
+	{
+		OutTextures.Add(FilePaths[Index], MoveTemp(Prefetched[Index]));
+		Stats.BytesRead += FileSizes[Index];
+		INC_MEMORY_STAT_BY(STAT_UEMeshBPExport_BytesRead, FileSizes[Index]);
 	}
-	MaterialJson->SetArrayField(TEXT("TextureParameters"), TextureParamsArray);
 	
-	// Ensure directory exists
-	FString MaterialDir = FPaths::GetPath(MaterialJsonPath);
-	if (!PlatformFile.DirectoryExists(*MaterialDir))
+	Stats.TexturePrefetchSeconds += FPlatformTime::Seconds() - PrefetchStartTime;
+}
+
+// Helper function: Create a texture from an image decoded by PrefetchTextures, set up the way UTextureFactory sets up an imported one
+static UTexture2D* CreateTextureFromImage(const FImage& Image, const FString& FilePath, UPackage* Package, const FString& TextureName, UTextureFactory* TextureFactory)
+{
+	UImportSubsystem* ImportSubsystem = GEditor ? GEditor->GetEditorSubsystem<UImportSubsystem>() : nullptr;
+	if (ImportSubsystem)
 	{
-		PlatformFile.CreateDirectoryTree(*MaterialDir);
+		ImportSubsystem->BroadcastAssetPreImport(TextureFactory, UTexture2D::StaticClass(), Package, *TextureName, *FPaths::GetExtension(FilePath));
 	}
 	
-	FString JsonString;
-	TSharedRef<TJsonWriter<>> JsonWriter = TJsonWriterFactory<>::Create(&JsonString);
-	FJsonSerializer::Serialize(MaterialJson.ToSharedRef(), JsonWriter);
+	UTexture2D* Texture = NewObject<UTexture2D>(Package, *TextureName, RF_Standalone | RF_Public);
+	Texture->Source.Init(Image);
+	Texture->Source.UseHashAsGuid();
 	
-	if (FFileHelper::SaveStringToFile(JsonString, *MaterialJsonPath))
+	// Same format and alpha checks as the factory: HDR images stay linear, gray images use grayscale compression
+	// and an alpha channel that is opaque everywhere is dropped when compressing
+	if (ERawImageFormat::IsHDR(Image.Format))
 	{
-		UE_LOG(LogTemp, Log, TEXT("Exported material JSON to: %s"), *MaterialJsonPath);
-		return MaterialRelativePath + TEXT("_material.json");
+		Texture->CompressionSettings = TC_HDR;
+		Texture->SRGB = false;
 	}
-	else
+	else if (Image.Format == ERawImageFormat::G8 || Image.Format == ERawImageFormat::G16)
+	{
+		Texture->CompressionSettings = TC_Grayscale;
+	}
+	Texture->CompressionNoAlpha = !FImageCore::DetectAlphaChannel(Image);
+	Texture->AssetImportData->Update(FilePath);
+	
+	if (ImportSubsystem)
 	{
-		UE_LOG(LogTemp, Error, TEXT("Failed to export material JSON: %s"), *MaterialJsonPath);
-		return FString();
+		ImportSubsystem->BroadcastAssetPostImport(TextureFactory, Texture);
 	}
+	
+	return Texture;
 }
 
-// Helper function: Process a single skeletal mesh
-static TSharedPtr<FJsonObject> ProcessSkeletalMesh(USkeletalMesh* SkeletalMesh, const FString& ExportBasePath, TSet<UTexture*>& ProcessedTextures)
+// Helper function: Import texture from file path
+static UTexture2D* ImportTextureFromFile(const FString& FilePath, const FString& DestinationPath, bool bSRGB, TextureCompressionSettings CompressionSettings, TextureGroup LODGroup = TEXTUREGROUP_World, const FPrefetchedTexture* Prefetched = nullptr, FDeferredMaterialRebuilds* DeferredRebuilds = nullptr, FUEMeshImportStats* Stats = nullptr)
 {
-	if (!SkeletalMesh)
+	TRACE_CPUPROFILER_EVENT_SCOPE(UEMeshBPExport_ImportTextureFromFile);
+	
+	// Check if file exists
+	if (!FPaths::FileExists(FilePath))
 	{
+		UE_LOG(LogUEMeshBPExport, Warning, TEXT("ImportTextureFromFile: File does not exist: %s"), *FilePath);
 		return nullptr;
 	}
 	
-	TSharedPtr<FJsonObject> MeshJson = MakeShareable(new FJsonObject);
-	MeshJson->SetStringField(TEXT("MeshName"), SkeletalMesh->GetName());
-	MeshJson->SetStringField(TEXT("MeshAssetPath"), SkeletalMesh->GetPathName());
-	
-	// Get relative path and construct FBX export path
-	FString MeshRelativePath = GetRelativePathFromGame(SkeletalMesh->GetPathName());
-	FString FBXPath = FPaths::Combine(ExportBasePath, MeshRelativePath + TEXT(".fbx"));
-	
-	// Ensure directory exists
-	FString MeshDir = FPaths::GetPath(FBXPath);
-	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
-	if (!PlatformFile.DirectoryExists(*MeshDir))
-	{
-		PlatformFile.CreateDirectoryTree(*MeshDir);
-	}
+	// Get texture name from file path
+	FString TextureName = FPaths::GetBaseFilename(FilePath);
+	FString PackageName = DestinationPath / TextureName;
 	
-	// Export skeletal mesh to FBX
-	if (ExportSkeletalMeshToFBX(SkeletalMesh, FBXPath))
+	// Check if texture already exists. One imported with other settings for another slot is left as it is,
+	// the file is imported a second time next to it with the compression setting appended to its name.
+	UTexture2D* ExistingTexture = FindImportedTexture(FilePath, DestinationPath);
+	if (ExistingTexture && (ExistingTexture->SRGB != bSRGB || ExistingTexture->CompressionSettings != CompressionSettings))
 	{
-		MeshJson->SetStringField(TEXT("ExportedFBXPath"), MeshRelativePath + TEXT(".fbx"));
+		TextureName += TEXT("_") + StaticEnum<TextureCompressionSettings>()->GetNameStringByValue(CompressionSettings);
+		PackageName = DestinationPath / TextureName;
+		UPackage* ExistingPackage = FindPackage(nullptr, *PackageName);
+		ExistingTexture = ExistingPackage ? FindObject<UTexture2D>(ExistingPackage, *TextureName) : nullptr;
 	}
-	else
+	if (ExistingTexture)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("Failed to export skeletal mesh: %s"), *SkeletalMesh->GetName());
-		return nullptr;
+		UE_LOG(LogUEMeshBPExport, Log, TEXT("Texture already exists, skipping: %s"), *PackageName);
+		if (Stats)
+		{
+			Stats->NumTexturesReused++;
+		}
+		return ExistingTexture;
 	}
 	
-	// Process materials
-	const TArray<FSkeletalMaterial>& SkeletalMaterials = SkeletalMesh->GetMaterials();
-	TArray<TSharedPtr<FJsonValue>> MaterialsArray;
-	
-	for (int32 MatIdx = 0; MatIdx < SkeletalMaterials.Num(); MatIdx++)
+	// The same bytes imported before under another path, or in an earlier editor session
+	if (Prefetched && Prefetched->bHashed)
 	{
-		UMaterialInterface* Material = SkeletalMaterials[MatIdx].MaterialInterface;
-		if (Material)
+		if (UTexture2D* DuplicateTexture = FUEMeshTextureHashIndex::Find(Prefetched->FileHash, bSRGB, CompressionSettings))
 		{
-			TSharedPtr<FJsonObject> MaterialRefJson = MakeShareable(new FJsonObject);
-			MaterialRefJson->SetNumberField(TEXT("MaterialSlotIndex"), MatIdx);
-			MaterialRefJson->SetStringField(TEXT("MaterialSlotName"), SkeletalMaterials[MatIdx].MaterialSlotName.ToString());
-			
-			// Export material and get JSON path
-			FString MaterialJsonPath = ExportMaterialToJSON(Material, ExportBasePath, ProcessedTextures);
-			if (!MaterialJsonPath.IsEmpty())
+			UE_LOG(LogUEMeshBPExport, Log, TEXT("Texture file matches %s, skipping: %s"), *DuplicateTexture->GetPathName(), *FilePath);
+			if (Stats)
 			{
-				MaterialRefJson->SetStringField(TEXT("MaterialJSONPath"), MaterialJsonPath);
+				Stats->NumTexturesDeduplicated++;
 			}
-			
-			MaterialsArray.Add(MakeShareable(new FJsonValueObject(MaterialRefJson)));
+			return DuplicateTexture;
 		}
 	}
 	
-	MeshJson->SetArrayField(TEXT("Materials"), MaterialsArray);
-	
-	return MeshJson;
-}
-#endif
-
-bool UUEMeshBPExportFuncsBPLibrary::ExportSkelMeshes(AActor* Actor, const FString& ExportName, const FString& ExportPath)
-{
-#if WITH_EDITOR
-	if (!Actor)
-	{
-		UE_LOG(LogTemp, Error, TEXT("ExportSkelMeshes: Actor is null"));
-		return false;
-	}
-	
-	if (ExportPath.IsEmpty())
-	{
-		UE_LOG(LogTemp, Error, TEXT("ExportSkelMeshes: ExportPath is empty"));
-		return false;
-	}
+	// Create texture factory
+	UTextureFactory* TextureFactory = NewObject<UTextureFactory>();
+	TextureFactory->SuppressImportOverwriteDialog();
+	TextureFactory->bUseHashAsGuid = true;
 	
-	// Ensure export directory exists
-	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
-	if (!PlatformFile.DirectoryExists(*ExportPath))
+	// Load texture data, unless PrefetchTextures already read it on a worker thread
+	const bool bDecoded = Prefetched && Prefetched->bDecoded;
+	TArray64<uint8> LoadedFileData;
+	const TArray64<uint8>* FileData = Prefetched && Prefetched->bLoaded ? &Prefetched->FileData : nullptr;
+	uint64 FileHash = bDecoded || FileData ? Prefetched->FileHash : 0;
+	if (!bDecoded && !FileData)
 	{
-		if (!PlatformFile.CreateDirectoryTree(*ExportPath))
+		if (!FFileHelper::LoadFileToArray(LoadedFileData, *FilePath))
 		{
-			UE_LOG(LogTemp, Error, TEXT("ExportSkelMeshes: Failed to create directory: %s"), *ExportPath);
-			return false;
+			UE_LOG(LogUEMeshBPExport, Error, TEXT("Failed to load texture file: %s"), *FilePath);
+			return nullptr;
+		}
+		INC_MEMORY_STAT_BY(STAT_UEMeshBPExport_BytesRead, LoadedFileData.Num());
+		if (Stats)
+		{
+			Stats->BytesRead += LoadedFileData.Num();
+		}
+		
+		FileData = &LoadedFileData;
+		FileHash = FUEMeshTextureHashIndex::HashFileData(LoadedFileData.GetData(), LoadedFileData.Num());
+		if (UTexture2D* DuplicateTexture = FUEMeshTextureHashIndex::Find(FileHash, bSRGB, CompressionSettings))
+		{
+			UE_LOG(LogUEMeshBPExport, Log, TEXT("Texture file matches %s, skipping: %s"), *DuplicateTexture->GetPathName(), *FilePath);
+			if (Stats)
+			{
+				Stats->NumTexturesDeduplicated++;
+			}
+			return DuplicateTexture;
 		}
 	}
 	
-	// Get all skeletal mesh components
-	TArray<USkeletalMeshComponent*> SkelMeshComponents;
-	Actor->GetComponents<USkeletalMeshComponent>(SkelMeshComponents);
+	// Create package
+	UPackage* Package = CreatePackage(*PackageName);
+	Package->FullyLoad();
 	
-	if (SkelMeshComponents.Num() == 0)
+	// Import texture, formats ImageWrapper could not decode on a worker thread go through the factory
+	UTexture2D* Texture = nullptr;
+	if (bDecoded)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("ExportSkelMeshes: No SkeletalMeshComponent found in Actor"));
-		return false;
+		Texture = CreateTextureFromImage(Prefetched->Image, FilePath, Package, TextureName, TextureFactory);
+	}
+	else
+	{
+		const uint8* BufferStart = FileData->GetData();
+		const uint8* BufferEnd = BufferStart + FileData->Num();
+		
+		Texture = Cast<UTexture2D>(TextureFactory->FactoryCreateBinary(
+			UTexture2D::StaticClass(),
+			Package,
+			*TextureName,
+			RF_Standalone | RF_Public,
+			nullptr,
+			*FPaths::GetExtension(FilePath),
+			BufferStart,
+			BufferEnd,
+			nullptr
+		));
 	}
 	
-	// Track processed meshes to avoid duplicates
-	TSet<USkeletalMesh*> ProcessedMeshes;
-	TSet<UTexture*> ProcessedTextures;
-	TArray<TSharedPtr<FJsonValue>> MeshesArray;
-	
-	// Process each skeletal mesh component
-	for (USkeletalMeshComponent* SkelMeshComp : SkelMeshComponents)
+	if (Texture)
 	{
-		if (!SkelMeshComp || !SkelMeshComp->GetSkeletalMeshAsset())
+		// Set texture properties
+		Texture->SRGB = bSRGB;
+		Texture->CompressionSettings = CompressionSettings;
+		Texture->LODGroup = LODGroup;
+		if (DeferredRebuilds)
 		{
-			continue;
+			DeferredRebuilds->Textures.Add(Texture);
 		}
-		
-		USkeletalMesh* SkelMesh = Cast<USkeletalMesh>(SkelMeshComp->GetSkeletalMeshAsset());
-		if (!SkelMesh || ProcessedMeshes.Contains(SkelMesh))
+		else
 		{
-			continue;
+			Texture->PostEditChange();
 		}
 		
-		ProcessedMeshes.Add(SkelMesh);
+		// Notify asset registry
+		FAssetRegistryModule::AssetCreated(Texture);
+		Package->MarkPackageDirty();
+		FUEMeshTextureHashIndex::Add(FileHash, bSRGB, CompressionSettings, Texture);
 		
-		// Process skeletal mesh
-		TSharedPtr<FJsonObject> MeshJson = ProcessSkeletalMesh(SkelMesh, ExportPath, ProcessedTextures);
-		if (MeshJson.IsValid())
+		UE_LOG(LogUEMeshBPExport, Log, TEXT("Successfully imported texture: %s"), *PackageName);
+		INC_DWORD_STAT(STAT_UEMeshBPExport_TexturesImported);
+		if (Stats)
 		{
-			MeshesArray.Add(MakeShareable(new FJsonValueObject(MeshJson)));
+			Stats->NumTexturesImported++;
 		}
 	}
+	else
+	{
+		UE_LOG(LogUEMeshBPExport, Error, TEXT("Failed to import texture: %s"), *FilePath);
+	}
 	
-	// Create actor-level JSON
-	TSharedPtr<FJsonObject> ActorJson = MakeShareable(new FJsonObject);
-	ActorJson->SetStringField(TEXT("ActorName"), Actor->GetName());
-	ActorJson->SetArrayField(TEXT("SkeletalMeshes"), MeshesArray);
-	
-	// Save actor JSON
-	FString ActorJsonPath = FPaths::Combine(ExportPath, ExportName + TEXT(".json"));
-	FString JsonString;
-	TSharedRef<TJsonWriter<>> JsonWriter = TJsonWriterFactory<>::Create(&JsonString);
-	FJsonSerializer::Serialize(ActorJson.ToSharedRef(), JsonWriter);
-	
-	if (FFileHelper::SaveStringToFile(JsonString, *ActorJsonPath))
+	return Texture;
+}
+
+// Helper function: Extract relative path and import texture
+static UTexture2D* ImportTextureWithRelativePath(const FString& _TexturePath, const FString& _TargetUEPath, const FString& SourceFbxPath, const FTexturePrefetchMap& PrefetchedTextures, FDeferredMaterialRebuilds& DeferredRebuilds, FUEMeshImportStats& Stats, bool bSRGB, TextureCompressionSettings CompressionSettings = TC_Default, TextureGroup LODGroup = TEXTUREGROUP_World)
+{
+	FString TexturePath = NormalizeTexturePath(_TexturePath);
+	if (!FPaths::FileExists(TexturePath))
 	{
-		UE_LOG(LogTemp, Log, TEXT("ExportSkelMeshes: Successfully exported actor JSON to: %s"), *ActorJsonPath);
-		UE_LOG(LogTemp, Log, TEXT("ExportSkelMeshes: Export completed. Processed %d meshes, %d textures"),
-			ProcessedMeshes.Num(), ProcessedTextures.Num());
-		return true;
+		return nullptr;
 	}
-	else
+	
+	const double TextureStartTime = FPlatformTime::Seconds();
+	FString DestPath = GetTextureDestinationPath(TexturePath, _TargetUEPath, SourceFbxPath);
+	
+	// Linear textures without a compression setting of their own are compressed as normal maps
+	if (CompressionSettings == TC_Default && !bSRGB)
 	{
-		UE_LOG(LogTemp, Error, TEXT("ExportSkelMeshes: Failed to export actor JSON to: %s"), *ActorJsonPath);
-		return false;
+		CompressionSettings = TC_Normalmap;
 	}
 	
-#else
-	UE_LOG(LogTemp, Error, TEXT("ExportSkelMeshes: This function is only available in Editor"));
-	return false;
-#endif
+	// The compression setting is part of the lookup, a texture shared by other slots or meshes is never changed here
+	UTexture2D* Texture = ImportTextureFromFile(TexturePath, DestPath, bSRGB, CompressionSettings, LODGroup, PrefetchedTextures.Find(TexturePath), &DeferredRebuilds, &Stats);
+	Stats.TextureImportSeconds += FPlatformTime::Seconds() - TextureStartTime;
+	
+	return Texture;
 }
 
-TArray<FString> UUEMeshBPExportFuncsBPLibrary::ListFiles(const FString& Path, const FString& FilterString, bool bRecursive)
+// Helper function: Run the deferred PostEditChange calls, textures first since material instances and meshes depend on them
+static void FlushDeferredMaterialRebuilds(FDeferredMaterialRebuilds& DeferredRebuilds, FUEMeshImportStats& Stats)
 {
-	TArray<FString> Result;
+	const int32 NumRebuilds = DeferredRebuilds.Num();
+	if (NumRebuilds == 0)
+	{
+		return;
+	}
 	
-	// Check if path exists
-	if (!FPaths::DirectoryExists(Path))
+	TRACE_CPUPROFILER_EVENT_SCOPE(UEMeshBPExport_FlushDeferredMaterialRebuilds);
+	const double RebuildStartTime = FPlatformTime::Seconds();
+	FScopedSlowTask SlowTask(NumRebuilds, LOCTEXT("RebuildingImportedAssets", "Rebuilding imported textures, materials and meshes..."));
+	SlowTask.MakeDialogDelayed(1.0f);
+	
+	for (UTexture* Texture : DeferredRebuilds.Textures)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("ListFiles: Directory does not exist: %s"), *Path);
-		return Result;
+		SlowTask.EnterProgressFrame(1, FText::FromString(Texture->GetName()));
+		Texture->PostEditChange();
 	}
 	
-	// Prepare search pattern
-	FString SearchPattern = FilterString.IsEmpty() ? TEXT("*.*") : FilterString;
-	FString FullSearchPath = FPaths::Combine(Path, SearchPattern);
+	for (UMaterialInstanceConstant* MaterialInstance : DeferredRebuilds.MaterialInstances)
+	{
+		SlowTask.EnterProgressFrame(1, FText::FromString(MaterialInstance->GetName()));
+		MaterialInstance->PostEditChange();
+	}
 	
-	// Find files in current directory
-	IFileManager& FileManager = IFileManager::Get();
+	for (UObject* Mesh : DeferredRebuilds.Meshes)
+	{
+		SlowTask.EnterProgressFrame(1, FText::FromString(Mesh->GetName()));
+		Mesh->PostEditChange();
+	}
 	
-	if (bRecursive)
+	UE_LOG(LogUEMeshBPExport, Log, TEXT("Rebuilt %d textures, %d material instances and %d meshes in %.2fs"),
+		DeferredRebuilds.Textures.Num(), DeferredRebuilds.MaterialInstances.Num(), DeferredRebuilds.Meshes.Num(), FPlatformTime::Seconds() - RebuildStartTime);
+	Stats.RebuildSeconds += FPlatformTime::Seconds() - RebuildStartTime;
+	
+	DeferredRebuilds = FDeferredMaterialRebuilds();
+}
+
+// Helper function: Get the material slot names of an imported static or skeletal mesh
+static bool GetMeshMaterialSlotNames(UObject* MeshObject, TArray<FName>& OutMaterialSlotNames)
+{
+	if (UStaticMesh* StaticMesh = Cast<UStaticMesh>(MeshObject))
 	{
-		// Recursive search
-		FileManager.FindFilesRecursive(Result, *Path, *SearchPattern, true, false);
+		// Get static mesh materials
+		for (const FStaticMaterial& StaticMaterial : StaticMesh->GetStaticMaterials())
+		{
+			OutMaterialSlotNames.Add(StaticMaterial.MaterialSlotName);
+		}
+		return true;
 	}
-	else
+	else if (USkeletalMesh* SkeletalMesh = Cast<USkeletalMesh>(MeshObject))
 	{
-		// Non-recursive search
-		TArray<FString> FoundFiles;
-		FileManager.FindFiles(FoundFiles, *FullSearchPath, true, false);
-		
-		// Convert relative paths to full paths
-		for (const FString& FileName : FoundFiles)
+		// Get skeletal mesh materials
+		for (const FSkeletalMaterial& SkeletalMaterial : SkeletalMesh->GetMaterials())
 		{
-			Result.Add(FPaths::Combine(Path, FileName));
+			OutMaterialSlotNames.Add(SkeletalMaterial.MaterialSlotName);
 		}
+		return true;
 	}
-	
-	return Result;
+	return false;
 }
 
-#if WITH_EDITOR
-// Helper function: Import texture from file path
-static UTexture2D* ImportTextureFromFile(const FString& FilePath, const FString& DestinationPath, bool bSRGB, TextureGroup LODGroup = TEXTUREGROUP_World)
+// Texture files of one material slot, taken from its "Classified" entry. Paths are already normalized.
+struct FClassifiedTextures
 {
-	// Check if file exists
-	if (!FPaths::FileExists(FilePath))
+	bool bHasClassified = false;
+	FString Diffuse;
+	FString Normal;
+	FString Roughness;
+	FString Metallic;
+};
+
+// Material JSON parsed once into a slot name -> classified textures table
+struct FParsedMaterialManifest
+{
+	FDateTime Timestamp;
+	int64 FileSize = 0;
+	TMap<FName, FClassifiedTextures> Slots;
+};
+
+// Helper function: Load a material JSON through a process-wide cache keyed by path, size and modification time.
+// Only used from the game thread.
+static TSharedPtr<const FParsedMaterialManifest> LoadMaterialManifest(const FString& JsonPath, FUEMeshImportStats& Stats)
+{
+	static TMap<FString, TSharedPtr<const FParsedMaterialManifest>> ManifestCache;
+	check(IsInGameThread());
+	
+	// Check if JSON file exists
+	const FString FullJsonPath = FPaths::ConvertRelativePathToFull(JsonPath);
+	const FFileStatData StatData = FPlatformFileManager::Get().GetPlatformFile().GetStatData(*FullJsonPath);
+	if (!StatData.bIsValid || StatData.bIsDirectory)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("ImportTextureFromFile: File does not exist: %s"), *FilePath);
+		UE_LOG(LogUEMeshBPExport, Warning, TEXT("ImportMaterialFromJson: JSON file does not exist: %s"), *JsonPath);
+		ManifestCache.Remove(FullJsonPath);
 		return nullptr;
 	}
 	
-	// Get texture name from file path
-	FString TextureName = FPaths::GetBaseFilename(FilePath);
-	FString PackageName = DestinationPath / TextureName;
-	
-	// Check if texture already exists
-	UPackage* ExistingPackage = FindPackage(nullptr, *PackageName);
-	if (ExistingPackage)
+	if (const TSharedPtr<const FParsedMaterialManifest>* CachedManifest = ManifestCache.Find(FullJsonPath))
 	{
-		UTexture2D* ExistingTexture = FindObject<UTexture2D>(ExistingPackage, *TextureName);
-		if (ExistingTexture)
+		if ((*CachedManifest)->Timestamp == StatData.ModificationTime && (*CachedManifest)->FileSize == StatData.FileSize)
 		{
-			UE_LOG(LogTemp, Log, TEXT("Texture already exists, skipping: %s"), *PackageName);
-			return ExistingTexture;
+			Stats.NumManifestCacheHits++;
+			return *CachedManifest;
 		}
 	}
 	
-	// Create texture factory
-	UTextureFactory* TextureFactory = NewObject<UTextureFactory>();
-	TextureFactory->SuppressImportOverwriteDialog();
-	TextureFactory->bUseHashAsGuid = true;
+	TRACE_CPUPROFILER_EVENT_SCOPE(UEMeshBPExport_ParseMaterialJson);
+	Stats.NumManifestCacheMisses++;
 	
-	// Load texture data
-	TArray<uint8> FileData;
-	if (!FFileHelper::LoadFileToArray(FileData, *FilePath))
+	// Load JSON file
+	FString JsonString;
+	if (!FFileHelper::LoadFileToString(JsonString, *FullJsonPath))
 	{
-		UE_LOG(LogTemp, Error, TEXT("Failed to load texture file: %s"), *FilePath);
+		UE_LOG(LogUEMeshBPExport, Error, TEXT("Failed to load JSON file: %s"), *JsonPath);
 		return nullptr;
 	}
 	
-	// Create package
-	UPackage* Package = CreatePackage(*PackageName);
-	Package->FullyLoad();
+	// Parse JSON
+	TSharedPtr<FJsonObject> JsonObject;
+	TSharedRef<TJsonReader<>> JsonReader = TJsonReaderFactory<>::Create(JsonString);
+	if (!FJsonSerializer::Deserialize(JsonReader, JsonObject) || !JsonObject.IsValid())
+	{
+		UE_LOG(LogUEMeshBPExport, Error, TEXT("Failed to parse JSON file: %s"), *JsonPath);
+		return nullptr;
+	}
 	
-	// Import texture
-	const uint8* BufferStart = FileData.GetData();
-	const uint8* BufferEnd = BufferStart + FileData.Num();
-	
-	UTexture2D* Texture = Cast<UTexture2D>(TextureFactory->FactoryCreateBinary(
-		UTexture2D::StaticClass(),
-		Package,
-		*TextureName,
-		RF_Standalone | RF_Public,
-		nullptr,
-		*FPaths::GetExtension(FilePath),
-		BufferStart,
-		BufferEnd,
-		nullptr
-	));
+	// Index every slot once, lookups during binding are then a single FName hash
+	TSharedPtr<FParsedMaterialManifest> Manifest = MakeShared<FParsedMaterialManifest>();
+	Manifest->Timestamp = StatData.ModificationTime;
+	Manifest->FileSize = StatData.FileSize;
+	Manifest->Slots.Reserve(JsonObject->Values.Num());
 	
-	if (Texture)
+	for (const TPair<FString, TSharedPtr<FJsonValue>>& SlotPair : JsonObject->Values)
 	{
-		// Set texture properties
-		Texture->SRGB = bSRGB;
-		Texture->CompressionSettings = bSRGB ? TC_Default : TC_Normalmap;
-		Texture->LODGroup = LODGroup;
+		const TSharedPtr<FJsonObject>* MaterialJson = nullptr;
+		if (!SlotPair.Value.IsValid() || !SlotPair.Value->TryGetObject(MaterialJson))
+		{
+			continue;
+		}
 		
-		// Notify asset registry
-		FAssetRegistryModule::AssetCreated(Texture);
-		Package->MarkPackageDirty();
+		FClassifiedTextures& Classified = Manifest->Slots.Add(FName(*SlotPair.Key));
 		
-		UE_LOG(LogTemp, Log, TEXT("Successfully imported texture: %s"), *PackageName);
+		const TSharedPtr<FJsonObject>* ClassifiedJson = nullptr;
+		if (!(*MaterialJson)->TryGetObjectField(TEXT("Classified"), ClassifiedJson))
+		{
+			continue;
+		}
+		
+		Classified.bHasClassified = true;
+		if ((*ClassifiedJson)->TryGetStringField(TEXT("Diffuse"), Classified.Diffuse))
+		{
+			Classified.Diffuse = NormalizeTexturePath(Classified.Diffuse);
+		}
+		if ((*ClassifiedJson)->TryGetStringField(TEXT("Normal"), Classified.Normal))
+		{
+			Classified.Normal = NormalizeTexturePath(Classified.Normal);
+		}
+		if ((*ClassifiedJson)->TryGetStringField(TEXT("Roughness"), Classified.Roughness))
+		{
+			Classified.Roughness = NormalizeTexturePath(Classified.Roughness);
+		}
+		if ((*ClassifiedJson)->TryGetStringField(TEXT("Metallic"), Classified.Metallic))
+		{
+			Classified.Metallic = NormalizeTexturePath(Classified.Metallic);
+		}
 	}
-	else
+	
+	ManifestCache.Add(FullJsonPath, Manifest);
+	return Manifest;
+}
+
+// Helper function: Get the classified texture a material texture parameter of the binary manifest maps to, null if none
+static FString* GetClassifiedTextureForParameter(FClassifiedTextures& Classified, const FString& ParameterName)
+{
+	if (ParameterName.Contains(TEXT("Diffuse")) || ParameterName.Contains(TEXT("BaseColor")) || ParameterName.Contains(TEXT("Albedo")))
 	{
-		UE_LOG(LogTemp, Error, TEXT("Failed to import texture: %s"), *FilePath);
+		return &Classified.Diffuse;
 	}
-	
-	return Texture;
+	if (ParameterName.Contains(TEXT("Normal")))
+	{
+		return &Classified.Normal;
+	}
+	if (ParameterName.Contains(TEXT("Roughness")))
+	{
+		return &Classified.Roughness;
+	}
+	if (ParameterName.Contains(TEXT("Metallic")) || ParameterName.Contains(TEXT("Metalness")))
+	{
+		return &Classified.Metallic;
+	}
+	return nullptr;
 }
 
-// Helper function: Extract relative path and import texture
-static UTexture2D* ImportTextureWithRelativePath(const FString& _TexturePath, const FString& _TargetUEPath, const FString& SourceFbxPath, bool bSRGB, TextureCompressionSettings CompressionSettings = TC_Default, TextureGroup LODGroup = TEXTUREGROUP_World)
+// Helper function: Load the material slots of a mesh from the binary manifest of the export root, null if the mesh is not in it.
+// The manifest is decoded once per file version into a table per mesh and unmapped again, so a later export can replace it.
+static TSharedPtr<const FParsedMaterialManifest> LoadBinaryMaterialManifest(const FString& JsonPath, const FString& SourceFbxPath, FUEMeshImportStats& Stats)
 {
-	FString TexturePath = _TexturePath.Replace(TEXT("\\"), TEXT("/"));
-	if (!FPaths::FileExists(TexturePath))
+	struct FBinaryManifestCacheEntry
 	{
+		FDateTime Timestamp;
+		int64 FileSize = 0;
+		TMap<FString, TSharedPtr<const FParsedMaterialManifest>> MeshManifests;
+	};
+	static TMap<FString, FBinaryManifestCacheEntry> BinaryManifestCache;
+	check(IsInGameThread());
+	
+	const FString SourceRoot = FPaths::ConvertRelativePathToFull(SourceFbxPath);
+	const FString BinaryManifestPath = FPaths::Combine(SourceRoot, FUEMeshBinaryManifest::FileName);
+	const FFileStatData StatData = FPlatformFileManager::Get().GetPlatformFile().GetStatData(*BinaryManifestPath);
+	if (!StatData.bIsValid || StatData.bIsDirectory)
+	{
+		BinaryManifestCache.Remove(BinaryManifestPath);
 		return nullptr;
 	}
 	
-	// Extract relative path from absolute path
-	FString SourceRoot = SourceFbxPath.EndsWith(TEXT("/")) ? SourceFbxPath : SourceFbxPath + TEXT("/");
-	FString RelativePath = TexturePath;
-	int32 GameIndex = RelativePath.Find(SourceRoot, ESearchCase::IgnoreCase);
-	if (GameIndex != INDEX_NONE)
+	FBinaryManifestCacheEntry* CacheEntry = BinaryManifestCache.Find(BinaryManifestPath);
+	if (CacheEntry && CacheEntry->Timestamp == StatData.ModificationTime && CacheEntry->FileSize == StatData.FileSize)
 	{
-		RelativePath = RelativePath.RightChop(GameIndex + SourceRoot.Len());
-		RelativePath = FPaths::GetPath(RelativePath);
+		Stats.NumManifestCacheHits++;
 	}
 	else
 	{
-		RelativePath = FPaths::GetPath(FPaths::GetBaseFilename(TexturePath));
+		TRACE_CPUPROFILER_EVENT_SCOPE(UEMeshBPExport_LoadBinaryManifest);
+		Stats.NumManifestCacheMisses++;
+		
+		FUEMeshBinaryManifest BinaryManifest;
+		if (!BinaryManifest.Load(BinaryManifestPath))
+		{
+			UE_LOG(LogUEMeshBPExport, Error, TEXT("Failed to load binary manifest: %s"), *BinaryManifestPath);
+			BinaryManifestCache.Remove(BinaryManifestPath);
+			return nullptr;
+		}
+		
+		CacheEntry = &BinaryManifestCache.Add(BinaryManifestPath);
+		CacheEntry->Timestamp = StatData.ModificationTime;
+		CacheEntry->FileSize = StatData.FileSize;
+		
+		// Meshes are keyed without extension, the import JSON path of a mesh only differs from its file by extension
+		for (const TPair<FString, FUEMeshBinaryManifest::FMesh>& MeshPair : BinaryManifest.Meshes)
+		{
+			TSharedPtr<FParsedMaterialManifest> Manifest = MakeShared<FParsedMaterialManifest>();
+			Manifest->Timestamp = StatData.ModificationTime;
+			Manifest->FileSize = StatData.FileSize;
+			
+			for (const FUEMeshBinaryManifest::FMaterialRef& MaterialRef : MeshPair.Value.MaterialRefs)
+			{
+				FClassifiedTextures& Classified = Manifest->Slots.Add(FName(*MaterialRef.SlotName));
+				const FUEMeshBinaryManifest::FMaterial* Material = BinaryManifest.Materials.Find(MaterialRef.MaterialJsonPath);
+				if (!Material)
+				{
+					continue;
+				}
+				
+				Classified.bHasClassified = true;
+				for (const FUEMeshBinaryManifest::FTextureParameter& TextureParameter : Material->TextureParameters)
+				{
+					FString* ClassifiedPath = GetClassifiedTextureForParameter(Classified, TextureParameter.ParameterName);
+					if (ClassifiedPath && ClassifiedPath->IsEmpty())
+					{
+						*ClassifiedPath = NormalizeTexturePath(FPaths::Combine(SourceRoot, TextureParameter.ExportedPath));
+					}
+				}
+			}
+			
+			CacheEntry->MeshManifests.Add(FPaths::ChangeExtension(MeshPair.Key, FString()), Manifest);
+		}
 	}
 	
-	FString TargetUEPath = _TargetUEPath.EndsWith(TEXT("/")) ? _TargetUEPath : _TargetUEPath + TEXT("/");
-	FString DestPath = TargetUEPath + RelativePath;
-	UTexture2D* Texture = ImportTextureFromFile(TexturePath, DestPath, bSRGB, LODGroup);
-	
-	// Apply compression settings if texture was imported
-	if (Texture && CompressionSettings != TC_Default)
+	// MakePathRelativeTo treats its second argument as a directory only with a trailing slash
+	FString MeshRelativePath = FPaths::ConvertRelativePathToFull(JsonPath);
+	if (!FPaths::MakePathRelativeTo(MeshRelativePath, *(SourceRoot.EndsWith(TEXT("/")) ? SourceRoot : SourceRoot + TEXT("/"))))
 	{
-		Texture->CompressionSettings = CompressionSettings;
-		Texture->UpdateResource();
+		return nullptr;
 	}
 	
-	return Texture;
+	const TSharedPtr<const FParsedMaterialManifest>* MeshManifest = CacheEntry->MeshManifests.Find(FPaths::ChangeExtension(MeshRelativePath, FString()));
+	return MeshManifest ? *MeshManifest : nullptr;
 }
 
 // Helper function: Import material from JSON
-static void ImportMaterialFromJson(const FString& JsonPath, const FString& TargetUEPath, const FString& SourceFbxPath, const TArray<FString>& ImportedObjectPaths, UObject* ParentMaterialAsset)
+static void ImportMaterialFromJson(const FString& JsonPath, const FString& TargetUEPath, const FString& SourceFbxPath, const TArray<FString>& ImportedObjectPaths, UObject* ParentMaterialAsset, FUEMeshImportStats& Stats)
 {
-	// Check if JSON file exists
+	TRACE_CPUPROFILER_EVENT_SCOPE(UEMeshBPExport_ImportMaterialFromJson);
+	
+	// Exports written with bWriteBinaryManifest may ship manifest.umbm instead of a JSON per mesh
+	TSharedPtr<const FParsedMaterialManifest> Manifest;
 	if (!FPaths::FileExists(JsonPath))
 	{
-		UE_LOG(LogTemp, Warning, TEXT("ImportMaterialFromJson: JSON file does not exist: %s"), *JsonPath);
-		return;
+		Manifest = LoadBinaryMaterialManifest(JsonPath, SourceFbxPath, Stats);
 	}
 	
-	// Load JSON file
-	FString JsonString;
-	if (!FFileHelper::LoadFileToString(JsonString, *JsonPath))
+	// Parsed once per file version, shared by every mesh that uses the same material library
+	if (!Manifest.IsValid())
 	{
-		UE_LOG(LogTemp, Error, TEXT("Failed to load JSON file: %s"), *JsonPath);
-		return;
+		Manifest = LoadMaterialManifest(JsonPath, Stats);
 	}
-	
-	// Parse JSON
-	TSharedPtr<FJsonObject> JsonObject;
-	TSharedRef<TJsonReader<>> JsonReader = TJsonReaderFactory<>::Create(JsonString);
-	if (!FJsonSerializer::Deserialize(JsonReader, JsonObject) || !JsonObject.IsValid())
+	if (!Manifest.IsValid())
 	{
-		UE_LOG(LogTemp, Error, TEXT("Failed to parse JSON file: %s"), *JsonPath);
 		return;
 	}
 	
@@ -646,10 +856,54 @@ static void ImportMaterialFromJson(const FString& JsonPath, const FString& Targe
 	UMaterialInterface* ParentMaterial = Cast<UMaterialInterface>(ParentMaterialAsset);
 	if (!ParentMaterial)
 	{
-		UE_LOG(LogTemp, Error, TEXT("ImportMaterialFromJson: ParentMaterialAsset is not a valid material"));
+		UE_LOG(LogUEMeshBPExport, Error, TEXT("ImportMaterialFromJson: ParentMaterialAsset is not a valid material"));
 		return;
 	}
 	
+	// Prefetch: read and hash every texture referenced by the slots of the imported meshes in parallel,
+	// the per-slot loop below then only runs the texture factory on bytes already in memory
+	FTexturePrefetchMap PrefetchedTextures;
+	{
+		TArray<FString> TexturePathsToPrefetch;
+		TSet<FString> SeenTexturePaths;
+		for (const FString& ObjectPath : ImportedObjectPaths)
+		{
+			TArray<FName> MaterialSlotNames;
+			if (!GetMeshMaterialSlotNames(LoadObject<UObject>(nullptr, *ObjectPath), MaterialSlotNames))
+			{
+				continue;
+			}
+			
+			for (const FName& MaterialSlotName : MaterialSlotNames)
+			{
+				const FClassifiedTextures* Classified = Manifest->Slots.Find(MaterialSlotName);
+				if (!Classified || !Classified->bHasClassified)
+				{
+					continue;
+				}
+				
+				for (const FString* ClassifiedPath : { &Classified->Diffuse, &Classified->Normal, &Classified->Roughness, &Classified->Metallic })
+				{
+					const FString& TexturePath = *ClassifiedPath;
+					if (TexturePath.IsEmpty())
+					{
+						continue;
+					}
+					
+					if (!SeenTexturePaths.Contains(TexturePath) && !FindImportedTexture(TexturePath, GetTextureDestinationPath(TexturePath, TargetUEPath, SourceFbxPath)))
+					{
+						TexturePathsToPrefetch.Add(TexturePath);
+					}
+					SeenTexturePaths.Add(TexturePath);
+				}
+			}
+		}
+		
+		PrefetchTextures(TexturePathsToPrefetch, PrefetchedTextures, Stats);
+	}
+	
+	FDeferredMaterialRebuilds DeferredRebuilds;
+	
 	// Process each imported object
 	for (const FString& ObjectPath : ImportedObjectPaths)
 	{
@@ -657,35 +911,15 @@ static void ImportMaterialFromJson(const FString& JsonPath, const FString& Targe
 		UObject* LoadedObject = LoadObject<UObject>(nullptr, *ObjectPath);
 		if (!LoadedObject)
 		{
-			UE_LOG(LogTemp, Warning, TEXT("Failed to load imported object: %s"), *ObjectPath);
+			UE_LOG(LogUEMeshBPExport, Warning, TEXT("Failed to load imported object: %s"), *ObjectPath);
 			continue;
 		}
 		
 		// Get material slots
 		TArray<FName> MaterialSlotNames;
-		TArray<UMaterialInterface*> Materials;
-		
-		if (UStaticMesh* StaticMesh = Cast<UStaticMesh>(LoadedObject))
-		{
-			// Get static mesh materials
-			for (const FStaticMaterial& StaticMaterial : StaticMesh->GetStaticMaterials())
-			{
-				MaterialSlotNames.Add(StaticMaterial.MaterialSlotName);
-				Materials.Add(StaticMaterial.MaterialInterface);
-			}
-		}
-		else if (USkeletalMesh* SkeletalMesh = Cast<USkeletalMesh>(LoadedObject))
-		{
-			// Get skeletal mesh materials
-			for (const FSkeletalMaterial& SkeletalMaterial : SkeletalMesh->GetMaterials())
-			{
-				MaterialSlotNames.Add(SkeletalMaterial.MaterialSlotName);
-				Materials.Add(SkeletalMaterial.MaterialInterface);
-			}
-		}
-		else
+		if (!GetMeshMaterialSlotNames(LoadedObject, MaterialSlotNames))
 		{
-			UE_LOG(LogTemp, Warning, TEXT("Imported object is not a mesh: %s"), *ObjectPath);
+			UE_LOG(LogUEMeshBPExport, Warning, TEXT("Imported object is not a mesh: %s"), *ObjectPath);
 			continue;
 		}
 		
@@ -698,21 +932,19 @@ static void ImportMaterialFromJson(const FString& JsonPath, const FString& Targe
 			FString MaterialSlotName = MaterialSlotNames[SlotIndex].ToString();
 			
 			// Find material in JSON
-			if (!JsonObject->HasField(MaterialSlotName))
+			const FClassifiedTextures* Classified = Manifest->Slots.Find(MaterialSlotNames[SlotIndex]);
+			if (!Classified)
 			{
-				UE_LOG(LogTemp, Warning, TEXT("Material not found in JSON: %s"), *MaterialSlotName);
+				UE_LOG(LogUEMeshBPExport, Warning, TEXT("Material not found in JSON: %s"), *MaterialSlotName);
 				continue;
 			}
 			
-			TSharedPtr<FJsonObject> MaterialJson = JsonObject->GetObjectField(MaterialSlotName);
-			if (!MaterialJson.IsValid() || !MaterialJson->HasField(TEXT("Classified")))
+			if (!Classified->bHasClassified)
 			{
-				UE_LOG(LogTemp, Warning, TEXT("Material JSON missing Classified field: %s"), *MaterialSlotName);
+				UE_LOG(LogUEMeshBPExport, Warning, TEXT("Material JSON missing Classified field: %s"), *MaterialSlotName);
 				continue;
 			}
 			
-			TSharedPtr<FJsonObject> ClassifiedJson = MaterialJson->GetObjectField(TEXT("Classified"));
-			
 			// Import textures from Classified field
 			UTexture2D* DiffuseTexture = nullptr;
 			UTexture2D* NormalTexture = nullptr;
@@ -720,28 +952,24 @@ static void ImportMaterialFromJson(const FString& JsonPath, const FString& Targe
 			UTexture2D* MetallicTexture = nullptr;
 						
 			// Import textures from Classified field
-			if (ClassifiedJson->HasField(TEXT("Diffuse")))
+			if (!Classified->Diffuse.IsEmpty())
 			{
-				FString DiffusePath = ClassifiedJson->GetStringField(TEXT("Diffuse"));
-				DiffuseTexture = ImportTextureWithRelativePath(DiffusePath, TargetUEPath, SourceFbxPath, true);
+				DiffuseTexture = ImportTextureWithRelativePath(Classified->Diffuse, TargetUEPath, SourceFbxPath, PrefetchedTextures, DeferredRebuilds, Stats, true);
 			}
 			
-			if (ClassifiedJson->HasField(TEXT("Normal")))
+			if (!Classified->Normal.IsEmpty())
 			{
-				FString NormalPath = ClassifiedJson->GetStringField(TEXT("Normal"));
-				NormalTexture = ImportTextureWithRelativePath(NormalPath, TargetUEPath, SourceFbxPath, false, TC_Normalmap, TEXTUREGROUP_WorldNormalMap);
+				NormalTexture = ImportTextureWithRelativePath(Classified->Normal, TargetUEPath, SourceFbxPath, PrefetchedTextures, DeferredRebuilds, Stats, false, TC_Normalmap, TEXTUREGROUP_WorldNormalMap);
 			}
 			
-			if (ClassifiedJson->HasField(TEXT("Roughness")))
+			if (!Classified->Roughness.IsEmpty())
 			{
-				FString RoughnessPath = ClassifiedJson->GetStringField(TEXT("Roughness"));
-				RoughnessTexture = ImportTextureWithRelativePath(RoughnessPath, TargetUEPath, SourceFbxPath, false, TC_Masks);
+				RoughnessTexture = ImportTextureWithRelativePath(Classified->Roughness, TargetUEPath, SourceFbxPath, PrefetchedTextures, DeferredRebuilds, Stats, false, TC_Masks);
 			}
 			
-			if (ClassifiedJson->HasField(TEXT("Metallic")))
+			if (!Classified->Metallic.IsEmpty())
 			{
-				FString MetallicPath = ClassifiedJson->GetStringField(TEXT("Metallic"));
-				MetallicTexture = ImportTextureWithRelativePath(MetallicPath, TargetUEPath, SourceFbxPath, false, TC_Masks);
+				MetallicTexture = ImportTextureWithRelativePath(Classified->Metallic, TargetUEPath, SourceFbxPath, PrefetchedTextures, DeferredRebuilds, Stats, false, TC_Masks);
 			}
 			
 			// Create material instance
@@ -757,7 +985,8 @@ static void ImportMaterialFromJson(const FString& JsonPath, const FString& Targe
 				MaterialInstance = FindObject<UMaterialInstanceConstant>(ExistingMIPackage, *MaterialInstanceName);
 				if (MaterialInstance)
 				{
-					UE_LOG(LogTemp, Log, TEXT("Material instance already exists, skipping: %s"), *MaterialInstancePackageName);
+					UE_LOG(LogUEMeshBPExport, Log, TEXT("Material instance already exists, skipping: %s"), *MaterialInstancePackageName);
+					Stats.NumMaterialInstancesReused++;
 				}
 			}
 			
@@ -782,7 +1011,9 @@ static void ImportMaterialFromJson(const FString& JsonPath, const FString& Targe
 					FAssetRegistryModule::AssetCreated(MaterialInstance);
 					MIPackage->MarkPackageDirty();
 					
-					UE_LOG(LogTemp, Log, TEXT("Created material instance: %s"), *MaterialInstancePackageName);
+					UE_LOG(LogUEMeshBPExport, Log, TEXT("Created material instance: %s"), *MaterialInstancePackageName);
+					INC_DWORD_STAT(STAT_UEMeshBPExport_MaterialInstancesCreated);
+					Stats.NumMaterialInstancesCreated++;
 				}
 			}
 			
@@ -817,54 +1048,56 @@ static void ImportMaterialFromJson(const FString& JsonPath, const FString& Targe
 				
 				if (bModified)
 				{
-					MaterialInstance->PostEditChange();
+					DeferredRebuilds.MaterialInstances.Add(MaterialInstance);
 				}
 				
 				// Apply material instance to mesh slot
 				if (UStaticMesh* StaticMesh = Cast<UStaticMesh>(LoadedObject))
 				{
 					StaticMesh->SetMaterial(SlotIndex, MaterialInstance);
-					StaticMesh->PostEditChange();
-					UE_LOG(LogTemp, Log, TEXT("Applied material instance to static mesh slot %d"), SlotIndex);
+					DeferredRebuilds.Meshes.Add(StaticMesh);
+					UE_LOG(LogUEMeshBPExport, Log, TEXT("Applied material instance to static mesh slot %d"), SlotIndex);
 				}
 				else if (USkeletalMesh* SkeletalMesh = Cast<USkeletalMesh>(LoadedObject))
 				{
 					SkeletalMesh->GetMaterials()[SlotIndex].MaterialInterface = MaterialInstance;
-					SkeletalMesh->PostEditChange();
-					UE_LOG(LogTemp, Log, TEXT("Applied material instance to skeletal mesh slot %d"), SlotIndex);
+					DeferredRebuilds.Meshes.Add(SkeletalMesh);
+					UE_LOG(LogUEMeshBPExport, Log, TEXT("Applied material instance to skeletal mesh slot %d"), SlotIndex);
 				}
 			}
 		}
 	}
+	
+	FlushDeferredMaterialRebuilds(DeferredRebuilds, Stats);
 }
 #endif
 
-bool UUEMeshBPExportFuncsBPLibrary::ImportMesh(const FString& TargetUEPath, const FString& SourceFbxPath, const FString& MeshName, bool bImportMaterial, bool bImportSkeleton, UObject* ParentMaterialAsset, float Scale)
-{
 #if WITH_EDITOR
-	FString MeshBaseName = FPaths::GetBaseFilename(MeshName);
-	FString MeshPath = FPaths::Combine(SourceFbxPath, MeshName);
+// Helper function: Validate an FBX file and create a rooted import task for it
+static UAssetImportTask* CreateFbxImportTask(const FString& TargetUEPath, const FString& MeshPath, bool bImportSkeleton, float Scale, const TCHAR* LogPrefix)
+{
+	FString MeshBaseName = FPaths::GetBaseFilename(MeshPath);
 	// Check if file exists
 	if (!FPaths::FileExists(MeshPath))
 	{
-		UE_LOG(LogTemp, Error, TEXT("ImportMesh: File does not exist: %s"), *MeshPath);
-		return false;
+		UE_LOG(LogUEMeshBPExport, Error, TEXT("%s: File does not exist: %s"), LogPrefix, *MeshPath);
+		return nullptr;
 	}
 	
 	// Check if file is FBX
 	FString Extension = FPaths::GetExtension(MeshPath).ToLower();
 	if (Extension != TEXT("fbx"))
 	{
-		UE_LOG(LogTemp, Error, TEXT("ImportMesh: Only FBX files are supported, got: %s"), *Extension);
-		return false;
+		UE_LOG(LogUEMeshBPExport, Error, TEXT("%s: Only FBX files are supported, got: %s"), LogPrefix, *Extension);
+		return nullptr;
 	}
 	
 	// Create FBX factory
 	UFbxFactory* FbxFactory = NewObject<UFbxFactory>();
 	if (!FbxFactory)
 	{
-		UE_LOG(LogTemp, Error, TEXT("ImportMesh: Failed to create FbxFactory"));
-		return false;
+		UE_LOG(LogUEMeshBPExport, Error, TEXT("%s: Failed to create FbxFactory"), LogPrefix);
+		return nullptr;
 	}
 	
 	// Configure import settings
@@ -908,26 +1141,341 @@ bool UUEMeshBPExportFuncsBPLibrary::ImportMesh(const FString& TargetUEPath, cons
 	// Set factory import task
 	FbxFactory->SetAssetImportTask(ImportTask);
 	
+	return ImportTask;
+}
+
+// Helper function: Split the files of a sharded import into at most NumShards lists of indices into MeshNames, such that
+// no package is created from files of two different lists
+static TArray<TArray<int32>> PartitionImportFiles(const FString& TargetUEPath, const FString& SourceFbxPath, const TArray<FString>& MeshNames, bool bImportMaterial, int32 NumShards, FUEMeshImportStats& Stats)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UEMeshBPExport_PartitionImportFiles);
+	
+	TArray<int32> Parents;
+	Parents.SetNumUninitialized(MeshNames.Num());
+	for (int32 FileIndex = 0; FileIndex < MeshNames.Num(); FileIndex++)
+	{
+		Parents[FileIndex] = FileIndex;
+	}
+	auto FindRoot = [&Parents](int32 Node)
+	{
+		while (Parents[Node] != Node)
+		{
+			Parents[Node] = Parents[Parents[Node]];
+			Node = Parents[Node];
+		}
+		return Node;
+	};
+	
+	// Files creating the same package are joined: the mesh folder is named after the file without its directory,
+	// textures are created below the target path mirroring their source directory
+	TMap<FString, int32> PackageOwners;
+	for (int32 FileIndex = 0; FileIndex < MeshNames.Num(); FileIndex++)
+	{
+		const FString MeshPath = FPaths::Combine(SourceFbxPath, MeshNames[FileIndex]);
+		TArray<FString> PackageNames;
+		PackageNames.Add(FPaths::Combine(TargetUEPath, FPaths::GetBaseFilename(MeshPath)));
+		
+		if (bImportMaterial)
+		{
+			const FString JsonPath = MeshPath.Replace(TEXT(".fbx"), TEXT(".json"));
+			TSharedPtr<const FParsedMaterialManifest> Manifest;
+			if (!FPaths::FileExists(JsonPath))
+			{
+				Manifest = LoadBinaryMaterialManifest(JsonPath, SourceFbxPath, Stats);
+			}
+			if (!Manifest.IsValid())
+			{
+				Manifest = LoadMaterialManifest(JsonPath, Stats);
+			}
+			
+			if (Manifest.IsValid())
+			{
+				for (const TPair<FName, FClassifiedTextures>& Slot : Manifest->Slots)
+				{
+					for (const FString* TexturePath : { &Slot.Value.Diffuse, &Slot.Value.Normal, &Slot.Value.Roughness, &Slot.Value.Metallic })
+					{
+						if (!TexturePath->IsEmpty())
+						{
+							PackageNames.Add(GetTextureDestinationPath(*TexturePath, TargetUEPath, SourceFbxPath) / FPaths::GetBaseFilename(*TexturePath));
+						}
+					}
+				}
+			}
+		}
+		
+		for (const FString& PackageName : PackageNames)
+		{
+			if (const int32* Owner = PackageOwners.Find(PackageName))
+			{
+				Parents[FindRoot(FileIndex)] = FindRoot(*Owner);
+			}
+			else
+			{
+				PackageOwners.Add(PackageName, FileIndex);
+			}
+		}
+	}
+	
+	TMap<int32, TArray<int32>> Groups;
+	for (int32 FileIndex = 0; FileIndex < MeshNames.Num(); FileIndex++)
+	{
+		Groups.FindOrAdd(FindRoot(FileIndex)).Add(FileIndex);
+	}
+	
+	// Largest groups first, each into the shard with the fewest files so far
+	TArray<TArray<int32>> GroupFiles;
+	Groups.GenerateValueArray(GroupFiles);
+	GroupFiles.Sort([](const TArray<int32>& A, const TArray<int32>& B) { return A.Num() > B.Num(); });
+	
+	TArray<TArray<int32>> Shards;
+	Shards.SetNum(FMath::Clamp(NumShards, 1, FMath::Max(GroupFiles.Num(), 1)));
+	for (const TArray<int32>& Files : GroupFiles)
+	{
+		int32 SmallestShard = 0;
+		for (int32 ShardIndex = 1; ShardIndex < Shards.Num(); ShardIndex++)
+		{
+			if (Shards[ShardIndex].Num() < Shards[SmallestShard].Num())
+			{
+				SmallestShard = ShardIndex;
+			}
+		}
+		Shards[SmallestShard].Append(Files);
+	}
+	
+	return Shards;
+}
+
+// Helper function: Add the counters and stage times of a worker to the stats of a sharded import
+static void AddWorkerImportStats(FUEMeshImportStats& OutStats, const FUEMeshImportStats& WorkerStats)
+{
+	OutStats.NumTexturesImported += WorkerStats.NumTexturesImported;
+	OutStats.NumTexturesReused += WorkerStats.NumTexturesReused;
+	OutStats.NumTexturesDeduplicated += WorkerStats.NumTexturesDeduplicated;
+	OutStats.NumMaterialInstancesCreated += WorkerStats.NumMaterialInstancesCreated;
+	OutStats.NumMaterialInstancesReused += WorkerStats.NumMaterialInstancesReused;
+	OutStats.NumManifestCacheHits += WorkerStats.NumManifestCacheHits;
+	OutStats.NumManifestCacheMisses += WorkerStats.NumManifestCacheMisses;
+	OutStats.BytesRead += WorkerStats.BytesRead;
+	OutStats.MeshImportSeconds += WorkerStats.MeshImportSeconds;
+	OutStats.TexturePrefetchSeconds += WorkerStats.TexturePrefetchSeconds;
+	OutStats.TextureImportSeconds += WorkerStats.TextureImportSeconds;
+	OutStats.RebuildSeconds += WorkerStats.RebuildSeconds;
+	OutStats.MaterialSeconds += WorkerStats.MaterialSeconds;
+	OutStats.NumPackagesSaved += WorkerStats.NumPackagesSaved;
+	OutStats.SaveSeconds += WorkerStats.SaveSeconds;
+	OutStats.NumGarbageCollections += WorkerStats.NumGarbageCollections;
+	OutStats.PeakMemoryMB = FMath::Max(OutStats.PeakMemoryMB, WorkerStats.PeakMemoryMB);
+}
+
+// Helper function: Packages loaded in this process below a content path
+static TArray<UPackage*> GetLoadedPackagesBelow(const FString& ContentPath)
+{
+	const FString PathPrefix = ContentPath.EndsWith(TEXT("/")) ? ContentPath : ContentPath + TEXT("/");
+	TArray<UPackage*> Packages;
+	for (TObjectIterator<UPackage> It; It; ++It)
+	{
+		if (It->GetName().StartsWith(PathPrefix))
+		{
+			Packages.Add(*It);
+		}
+	}
+	return Packages;
+}
+
+// Helper function: Import the files in NumWorkers commandlet processes, each creating a disjoint set of packages
+static TArray<FUEMeshImportResult> ImportMeshesSharded(const FString& TargetUEPath, const FString& SourceFbxPath, const TArray<FString>& MeshNames, bool bImportMaterial, bool bImportSkeleton, UObject* ParentMaterialAsset, float Scale, FUEMeshImportStats& OutStats, EUEMeshImportSavePolicy SavePolicy, int32 SaveBatchSize, int32 MemoryBudgetMB, int32 NumWorkers)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UEMeshBPExport_ImportSharded);
+	const double StartTime = FPlatformTime::Seconds();
+	
+	TArray<FUEMeshImportResult> Results;
+	Results.SetNum(MeshNames.Num());
+	for (int32 MeshIndex = 0; MeshIndex < MeshNames.Num(); MeshIndex++)
+	{
+		Results[MeshIndex].MeshName = MeshNames[MeshIndex];
+	}
+	
+	// The workers load the parent material from disk
+	if (bImportMaterial && (!ParentMaterialAsset || ParentMaterialAsset->GetPackage()->IsDirty()))
+	{
+		UE_LOG(LogUEMeshBPExport, Error, TEXT("ImportMeshes: Sharded import needs a saved ParentMaterialAsset"));
+		OutStats.NumFilesFailed = MeshNames.Num();
+		return Results;
+	}
+	
+	// The workers overwrite the package files below TargetUEPath. Copies loaded here would go stale and be written back
+	// over their output by the next save, so they are saved and unloaded first, and reloaded afterwards if that failed.
+	FUEMeshImportSaver::SaveAll(&OutStats);
+	TArray<UPackage*> LoadedPackages = GetLoadedPackagesBelow(TargetUEPath);
+	if (ParentMaterialAsset)
+	{
+		LoadedPackages.Remove(ParentMaterialAsset->GetPackage());
+	}
+	
+	const TArray<UPackage*> DirtyPackages = LoadedPackages.FilterByPredicate([](const UPackage* Package) { return Package->IsDirty(); });
+	if (DirtyPackages.Num() > 0)
+	{
+		UE_LOG(LogUEMeshBPExport, Error, TEXT("ImportMeshes: Sharded import needs the %d modified packages below %s saved first, e.g. %s"),
+			DirtyPackages.Num(), *TargetUEPath, *DirtyPackages[0]->GetName());
+		OutStats.NumFilesFailed = MeshNames.Num();
+		return Results;
+	}
+	
+	TArray<FString> LoadedPackageNames;
+	for (const UPackage* Package : LoadedPackages)
+	{
+		LoadedPackageNames.Add(Package->GetName());
+	}
+	FText ErrorMessage;
+	if (LoadedPackages.Num() > 0 && !UPackageTools::UnloadPackages(LoadedPackages, ErrorMessage))
+	{
+		UE_LOG(LogUEMeshBPExport, Warning, TEXT("ImportMeshes: Not every package below %s could be unloaded, they are reloaded after the import: %s"), *TargetUEPath, *ErrorMessage.ToString());
+	}
+	
+	const TArray<TArray<int32>> Shards = PartitionImportFiles(TargetUEPath, SourceFbxPath, MeshNames, bImportMaterial, NumWorkers, OutStats);
+	const FString ShardDirectory = FPaths::ConvertRelativePathToFull(FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("UEMeshBPExport"), TEXT("ImportShards")));
+	IFileManager::Get().MakeDirectory(*ShardDirectory, true);
+	
+	// A worker that leaves its packages dirty imports nothing
+	const EUEMeshImportSavePolicy WorkerSavePolicy = SavePolicy == EUEMeshImportSavePolicy::None ? EUEMeshImportSavePolicy::EveryNPackages : SavePolicy;
+	
+	TArray<FUEMeshWorkerProcess> Workers;
+	TArray<FString> HashIndexChangesPaths;
+	for (int32 ShardIndex = 0; ShardIndex < Shards.Num(); ShardIndex++)
+	{
+		FUEMeshWorkerProcess& Worker = Workers.Emplace_GetRef(ShardDirectory, FString::Printf(TEXT("Shard%d"), ShardIndex));
+		const FString& HashIndexChangesPath = HashIndexChangesPaths.Add_GetRef(FPaths::Combine(ShardDirectory, FString::Printf(TEXT("Shard%d.textures.json"), ShardIndex)));
+		IFileManager::Get().Delete(*HashIndexChangesPath, false, true, true);
+		
+		FUEMeshJob Job;
+		FUEMeshImportJob& ImportJob = Job.Imports.AddDefaulted_GetRef();
+		ImportJob.SourceDirectory = FPaths::ConvertRelativePathToFull(SourceFbxPath);
+		ImportJob.TargetPath = TargetUEPath;
+		ImportJob.bImportMaterial = bImportMaterial;
+		ImportJob.bImportSkeleton = bImportSkeleton;
+		ImportJob.ParentMaterial = ParentMaterialAsset ? ParentMaterialAsset->GetPathName() : FString();
+		ImportJob.Scale = Scale;
+		ImportJob.SavePolicy = WorkerSavePolicy;
+		ImportJob.SaveBatchSize = SaveBatchSize;
+		ImportJob.MemoryBudgetMB = MemoryBudgetMB;
+		ImportJob.TextureHashIndexChangesFile = HashIndexChangesPath;
+		for (int32 FileIndex : Shards[ShardIndex])
+		{
+			ImportJob.Files.Add(MeshNames[FileIndex]);
+		}
+		
+		Worker.Launch(Job);
+	}
+	
+	UE_LOG(LogUEMeshBPExport, Log, TEXT("ImportMeshes: Importing %d files with %d workers"), MeshNames.Num(), Workers.Num());
+	
+	int32 NumSucceeded = 0;
+	bool bAllWorkersSucceeded = true;
+	for (int32 WorkerIndex = 0; WorkerIndex < Workers.Num(); WorkerIndex++)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(UEMeshBPExport_WaitForWorker);
+		
+		FUEMeshJobReport Report;
+		if (Workers[WorkerIndex].Wait(Report) != 0)
+		{
+			bAllWorkersSucceeded = false;
+		}
+		
+		// Files of a worker that died without a report stay failed
+		const TArray<int32>& ShardFiles = Shards[WorkerIndex];
+		if (Report.Imports.Num() == 1 && Report.Imports[0].Results.Num() == ShardFiles.Num())
+		{
+			for (int32 ShardFileIndex = 0; ShardFileIndex < ShardFiles.Num(); ShardFileIndex++)
+			{
+				Results[ShardFiles[ShardFileIndex]] = Report.Imports[0].Results[ShardFileIndex];
+				NumSucceeded += Results[ShardFiles[ShardFileIndex]].bSuccess ? 1 : 0;
+			}
+			AddWorkerImportStats(OutStats, Report.Imports[0].Stats);
+		}
+		
+		FUEMeshTextureHashIndex::MergeChanges(HashIndexChangesPaths[WorkerIndex]);
+	}
+	OutStats.WorkerSeconds = FPlatformTime::Seconds() - StartTime;
+	FUEMeshTextureHashIndex::Save();
+	
+	if (bAllWorkersSucceeded)
+	{
+		IFileManager::Get().DeleteDirectory(*ShardDirectory, false, true);
+	}
+	
+	// The packages were created by other processes, one scan makes them known to this editor
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(UEMeshBPExport_ScanImportedPaths);
+		FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
+		AssetRegistryModule.Get().ScanPathsSynchronous({ TargetUEPath }, true);
+	}
+	
+	// Packages still loaded, e.g. held by an open asset editor, take the files the workers wrote
+	TArray<UPackage*> PackagesToReload;
+	for (const FString& PackageName : LoadedPackageNames)
+	{
+		if (UPackage* Package = FindPackage(nullptr, *PackageName))
+		{
+			PackagesToReload.Add(Package);
+		}
+	}
+	if (PackagesToReload.Num() > 0 && !UPackageTools::ReloadPackages(PackagesToReload, ErrorMessage, UPackageTools::EReloadPackagesInteractionMode::AssumePositive))
+	{
+		UE_LOG(LogUEMeshBPExport, Warning, TEXT("ImportMeshes: Failed to reload %d packages below %s: %s"), PackagesToReload.Num(), *TargetUEPath, *ErrorMessage.ToString());
+	}
+	
+	OutStats.NumWorkers = Workers.Num();
+	OutStats.NumFilesImported = NumSucceeded;
+	OutStats.NumFilesFailed = MeshNames.Num() - NumSucceeded;
+	OutStats.TotalSeconds = FPlatformTime::Seconds() - StartTime;
+	
+	UE_LOG(LogUEMeshBPExport, Log, TEXT("ImportMeshes: %d workers imported %d of %d files in %.2fs (%d packages saved, peak worker memory %.0f MB)"),
+		Workers.Num(), NumSucceeded, MeshNames.Num(), OutStats.TotalSeconds, OutStats.NumPackagesSaved, OutStats.PeakMemoryMB);
+	return Results;
+}
+#endif
+
+bool UUEMeshBPExportFuncsBPLibrary::ImportMesh(const FString& TargetUEPath, const FString& SourceFbxPath, const FString& MeshName, bool bImportMaterial, bool bImportSkeleton, UObject* ParentMaterialAsset, float Scale, EUEMeshImportSavePolicy SavePolicy, int32 SaveBatchSize, int32 MemoryBudgetMB)
+{
+#if WITH_EDITOR
+	// Calls in a loop add up in the batch stats, SaveImportedPackages returns them
+	FUEMeshImportStats& BatchStats = FUEMeshImportSaver::GetBatchStats();
+	FUEMeshImportSaver Saver(TargetUEPath, SavePolicy, SaveBatchSize, MemoryBudgetMB, BatchStats);
+	
+	FString MeshPath = FPaths::Combine(SourceFbxPath, MeshName);
+	UAssetImportTask* ImportTask = CreateFbxImportTask(TargetUEPath, MeshPath, bImportSkeleton, Scale, TEXT("ImportMesh"));
+	if (!ImportTask)
+	{
+		BatchStats.NumFilesFailed++;
+		return false;
+	}
+	
 	// Execute import
 	FAssetToolsModule& AssetToolsModule = FModuleManager::LoadModuleChecked<FAssetToolsModule>("AssetTools");
 	TArray<UAssetImportTask*> ImportTasks;
 	ImportTasks.Add(ImportTask);
-	AssetToolsModule.Get().ImportAssetTasks(ImportTasks);
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(UEMeshBPExport_ImportFbx);
+		AssetToolsModule.Get().ImportAssetTasks(ImportTasks);
+	}
 	
 	// Check if import was successful
 	bool bSuccess = ImportTask->ImportedObjectPaths.Num() > 0;
 	
 	if (bSuccess)
 	{
-		UE_LOG(LogTemp, Log, TEXT("ImportMesh: Successfully imported %d objects from %s"), ImportTask->ImportedObjectPaths.Num(), *MeshPath);
+		BatchStats.NumFilesImported++;
+		INC_DWORD_STAT(STAT_UEMeshBPExport_MeshesImported);
+		UE_LOG(LogUEMeshBPExport, Log, TEXT("ImportMesh: Successfully imported %d objects from %s"), ImportTask->ImportedObjectPaths.Num(), *MeshPath);
 		for (const FString& ObjectPath : ImportTask->ImportedObjectPaths)
 		{
-			UE_LOG(LogTemp, Log, TEXT("  - %s"), *ObjectPath);
+			UE_LOG(LogUEMeshBPExport, Log, TEXT("  - %s"), *ObjectPath);
 		}
 	}
 	else
 	{
-		UE_LOG(LogTemp, Error, TEXT("ImportMesh: Failed to import mesh from %s"), *MeshPath);
+		BatchStats.NumFilesFailed++;
+		UE_LOG(LogUEMeshBPExport, Error, TEXT("ImportMesh: Failed to import mesh from %s"), *MeshPath);
 	}
 	
 	// Clean up
@@ -936,12 +1484,204 @@ bool UUEMeshBPExportFuncsBPLibrary::ImportMesh(const FString& TargetUEPath, cons
 	if (bImportMaterial)
 	{
 		FString JsonPath = MeshPath.Replace(TEXT(".fbx"), TEXT(".json"));
-		ImportMaterialFromJson(JsonPath, TargetUEPath, SourceFbxPath, ImportTask->ImportedObjectPaths, ParentMaterialAsset);
+		ImportMaterialFromJson(JsonPath, TargetUEPath, SourceFbxPath, ImportTask->ImportedObjectPaths, ParentMaterialAsset, BatchStats);
+		FUEMeshTextureHashIndex::Save();
 	}
 	
+	// PerMesh saves right away, EveryNPackages keeps the packages pending across calls until SaveBatchSize add up.
+	// The import task and factory are unreferenced from here on, a collection for the memory budget frees them too.
+	Saver.MeshFinished();
+	
 	return bSuccess;
 #else
-	UE_LOG(LogTemp, Error, TEXT("ImportMesh: This function is only available in editor builds"));
+	UE_LOG(LogUEMeshBPExport, Error, TEXT("ImportMesh: This function is only available in editor builds"));
+	return false;
+#endif
+}
+
+TArray<FUEMeshImportResult> UUEMeshBPExportFuncsBPLibrary::ImportMeshes(const FString& TargetUEPath, const FString& SourceFbxPath, const TArray<FString>& MeshNames, bool bImportMaterial, bool bImportSkeleton, UObject* ParentMaterialAsset, float Scale, FUEMeshImportStats& OutStats, EUEMeshImportSavePolicy SavePolicy, int32 SaveBatchSize, int32 MemoryBudgetMB, int32 NumWorkers)
+{
+	TArray<FUEMeshImportResult> Results;
+	OutStats = FUEMeshImportStats();
+	
+#if WITH_EDITOR
+	if (NumWorkers > 1 && MeshNames.Num() > 1)
+	{
+		return ImportMeshesSharded(TargetUEPath, SourceFbxPath, MeshNames, bImportMaterial, bImportSkeleton, ParentMaterialAsset, Scale, OutStats, SavePolicy, SaveBatchSize, MemoryBudgetMB, NumWorkers);
+	}
+	
+	TRACE_CPUPROFILER_EVENT_SCOPE(UEMeshBPExport_ImportMeshes);
+	const double StartTime = FPlatformTime::Seconds();
+	Results.SetNum(MeshNames.Num());
+	
+	for (int32 MeshIndex = 0; MeshIndex < MeshNames.Num(); MeshIndex++)
+	{
+		Results[MeshIndex].MeshName = MeshNames[MeshIndex];
+	}
+	
+	// Without a save policy every file goes into one ImportAssetTasks call. With one they are imported in chunks that
+	// are saved and unloaded before the next, so memory holds one chunk of unsaved meshes instead of the whole batch.
+	// A memory budget streams the files one at a time so it is checked before the next FBX scene is loaded.
+	FUEMeshImportSaver Saver(TargetUEPath, SavePolicy, SaveBatchSize, MemoryBudgetMB, OutStats);
+	int32 ChunkSize = MeshNames.Num();
+	if (SavePolicy == EUEMeshImportSavePolicy::PerMesh || MemoryBudgetMB > 0)
+	{
+		ChunkSize = 1;
+	}
+	else if (SavePolicy == EUEMeshImportSavePolicy::EveryNPackages)
+	{
+		ChunkSize = FMath::Max(SaveBatchSize, 1);
+	}
+	
+	// Tasks run in order inside each ImportAssetTasks call, the post import notification of each factory marks where its file ends
+	TArray<UAssetImportTask*> ImportTasks;
+	TArray<int32> TaskResultIndices;
+	TMap<UFactory*, int32> FactoryToTaskIndex;
+	TArray<double> TaskSeconds;
+	double LastPostImportTime = FPlatformTime::Seconds();
+	
+	UImportSubsystem* ImportSubsystem = GEditor ? GEditor->GetEditorSubsystem<UImportSubsystem>() : nullptr;
+	FDelegateHandle PostImportHandle;
+	if (ImportSubsystem)
+	{
+		PostImportHandle = ImportSubsystem->OnAssetPostImport.AddLambda([&FactoryToTaskIndex, &TaskSeconds, &LastPostImportTime](UFactory* Factory, UObject* CreatedObject)
+		{
+			if (const int32* TaskIndex = FactoryToTaskIndex.Find(Factory))
+			{
+				const double Now = FPlatformTime::Seconds();
+				TaskSeconds[*TaskIndex] += Now - LastPostImportTime;
+				LastPostImportTime = Now;
+			}
+		});
+	}
+	
+	FAssetToolsModule& AssetToolsModule = FModuleManager::LoadModuleChecked<FAssetToolsModule>("AssetTools");
+	int32 NumSucceeded = 0;
+	for (int32 ChunkStart = 0; ChunkStart < MeshNames.Num(); ChunkStart += ChunkSize)
+	{
+		// Tasks and their rooted factories are created per chunk, so the garbage collections between chunks can free them
+		const int32 ChunkEnd = FMath::Min(ChunkStart + ChunkSize, MeshNames.Num());
+		ImportTasks.Reset();
+		TaskResultIndices.Reset();
+		FactoryToTaskIndex.Reset();
+		for (int32 MeshIndex = ChunkStart; MeshIndex < ChunkEnd; MeshIndex++)
+		{
+			FString MeshPath = FPaths::Combine(SourceFbxPath, MeshNames[MeshIndex]);
+			UAssetImportTask* ImportTask = CreateFbxImportTask(TargetUEPath, MeshPath, bImportSkeleton, Scale, TEXT("ImportMeshes"));
+			if (ImportTask)
+			{
+				FactoryToTaskIndex.Add(ImportTask->Factory, ImportTasks.Num());
+				ImportTasks.Add(ImportTask);
+				TaskResultIndices.Add(MeshIndex);
+			}
+		}
+		if (ImportTasks.Num() == 0)
+		{
+			continue;
+		}
+		TaskSeconds.Reset();
+		TaskSeconds.SetNumZeroed(ImportTasks.Num());
+		
+		// Execute import
+		{
+			TRACE_CPUPROFILER_EVENT_SCOPE(UEMeshBPExport_ImportFbx);
+			LastPostImportTime = FPlatformTime::Seconds();
+			AssetToolsModule.Get().ImportAssetTasks(ImportTasks);
+		}
+		
+		for (int32 TaskIndex = 0; TaskIndex < ImportTasks.Num(); TaskIndex++)
+		{
+			UAssetImportTask* ImportTask = ImportTasks[TaskIndex];
+			FUEMeshImportResult& Result = Results[TaskResultIndices[TaskIndex]];
+			
+			Result.ImportedObjectPaths = ImportTask->ImportedObjectPaths;
+			Result.bSuccess = Result.ImportedObjectPaths.Num() > 0;
+			Result.ImportSeconds = TaskSeconds[TaskIndex];
+			OutStats.MeshImportSeconds += Result.ImportSeconds;
+			
+			// Clean up
+			ImportTask->RemoveFromRoot();
+			
+			if (!Result.bSuccess)
+			{
+				UE_LOG(LogUEMeshBPExport, Error, TEXT("ImportMeshes: Failed to import mesh from %s"), *ImportTask->Filename);
+				continue;
+			}
+			NumSucceeded++;
+			INC_DWORD_STAT(STAT_UEMeshBPExport_MeshesImported);
+			
+			if (bImportMaterial)
+			{
+				const double MaterialStartTime = FPlatformTime::Seconds();
+				FString JsonPath = ImportTask->Filename.Replace(TEXT(".fbx"), TEXT(".json"));
+				ImportMaterialFromJson(JsonPath, TargetUEPath, SourceFbxPath, Result.ImportedObjectPaths, ParentMaterialAsset, OutStats);
+				Result.MaterialSeconds = FPlatformTime::Seconds() - MaterialStartTime;
+				OutStats.MaterialSeconds += Result.MaterialSeconds;
+			}
+			
+			Saver.MeshFinished();
+		}
+	}
+	
+	if (ImportSubsystem)
+	{
+		ImportSubsystem->OnAssetPostImport.Remove(PostImportHandle);
+	}
+	
+	// The last chunk is written even if it is smaller than SaveBatchSize
+	if (SavePolicy != EUEMeshImportSavePolicy::None || MemoryBudgetMB > 0)
+	{
+		FUEMeshImportSaver::SaveAll(&OutStats);
+	}
+	
+	if (bImportMaterial)
+	{
+		FUEMeshTextureHashIndex::Save();
+	}
+	
+	OutStats.NumFilesImported = NumSucceeded;
+	OutStats.NumFilesFailed = MeshNames.Num() - NumSucceeded;
+	OutStats.TotalSeconds = FPlatformTime::Seconds() - StartTime;
+	
+	UE_LOG(LogUEMeshBPExport, Log, TEXT("ImportMeshes: Imported %d of %d files in %.2fs (mesh %.2fs, materials %.2fs, textures %d new/%d reused/%d deduplicated, material instances %d new/%d reused, manifest cache %d hits/%d misses, %.2f MB read, %d packages saved in %.2fs, %d garbage collections, peak memory %.0f MB)"),
+		NumSucceeded, MeshNames.Num(), OutStats.TotalSeconds, OutStats.MeshImportSeconds, OutStats.MaterialSeconds,
+		OutStats.NumTexturesImported, OutStats.NumTexturesReused, OutStats.NumTexturesDeduplicated, OutStats.NumMaterialInstancesCreated, OutStats.NumMaterialInstancesReused,
+		OutStats.NumManifestCacheHits, OutStats.NumManifestCacheMisses, OutStats.BytesRead / (1024.0 * 1024.0), OutStats.NumPackagesSaved, OutStats.SaveSeconds, OutStats.NumGarbageCollections, OutStats.PeakMemoryMB);
+#else
+	UE_LOG(LogUEMeshBPExport, Error, TEXT("ImportMeshes: This function is only available in editor builds"));
+#endif
+	
+	return Results;
+}
+
+int32 UUEMeshBPExportFuncsBPLibrary::SaveImportedPackages(FUEMeshImportStats& OutStats)
+{
+#if WITH_EDITOR
+	FUEMeshImportStats& BatchStats = FUEMeshImportSaver::GetBatchStats();
+	const int32 NumSaved = FUEMeshImportSaver::SaveAll(&BatchStats);
+	
+	OutStats = BatchStats;
+	BatchStats = FUEMeshImportStats();
+	
+	UE_LOG(LogUEMeshBPExport, Log, TEXT("SaveImportedPackages: %d files imported, %d failed, %d packages saved in %.2fs, %d garbage collections, peak memory %.0f MB"),
+		OutStats.NumFilesImported, OutStats.NumFilesFailed, OutStats.NumPackagesSaved, OutStats.SaveSeconds, OutStats.NumGarbageCollections, OutStats.PeakMemoryMB);
+	return NumSaved;
+#else
+	OutStats = FUEMeshImportStats();
+	return 0;
+#endif
+}
+
+bool UUEMeshBPExportFuncsBPLibrary::RunBenchmark(const FUEMeshBenchmarkSettings& Settings, FUEMeshBenchmarkReport& OutReport)
+{
+	OutReport = FUEMeshBenchmarkReport();
+	
+#if WITH_EDITOR
+	return RunUEMeshBenchmark(Settings, OutReport);
+#else
+	UE_LOG(LogUEMeshBPExport, Error, TEXT("RunBenchmark: This function is only available in editor builds"));
 	return false;
 #endif
-}
\ No newline at end of file
+}
+
+#undef LOCTEXT_NAMESPACE
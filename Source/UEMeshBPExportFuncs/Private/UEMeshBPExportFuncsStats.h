@@ -0,0 +1,26 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+
+/*
+*	Counters of the export and import stages, shown with "stat UEMeshBPExport" and in Unreal Insights.
+*	They accumulate over the editor session, the per-run numbers are returned in FUEMeshExportStats and FUEMeshImportStats.
+*	The stages themselves are marked with TRACE_CPUPROFILER_EVENT_SCOPE(UEMeshBPExport_<Stage>).
+*/
+
+DECLARE_STATS_GROUP(TEXT("UEMeshBPExport"), STATGROUP_UEMeshBPExport, STATCAT_Advanced);
+
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Meshes Exported"), STAT_UEMeshBPExport_MeshesExported, STATGROUP_UEMeshBPExport, );
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Materials Exported"), STAT_UEMeshBPExport_MaterialsExported, STATGROUP_UEMeshBPExport, );
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Textures Exported"), STAT_UEMeshBPExport_TexturesExported, STATGROUP_UEMeshBPExport, );
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Export Cache Hits"), STAT_UEMeshBPExport_CacheHits, STATGROUP_UEMeshBPExport, );
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Export Cache Misses"), STAT_UEMeshBPExport_CacheMisses, STATGROUP_UEMeshBPExport, );
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Bytes Written"), STAT_UEMeshBPExport_BytesWritten, STATGROUP_UEMeshBPExport, );
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Meshes Imported"), STAT_UEMeshBPExport_MeshesImported, STATGROUP_UEMeshBPExport, );
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Textures Imported"), STAT_UEMeshBPExport_TexturesImported, STATGROUP_UEMeshBPExport, );
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Material Instances Created"), STAT_UEMeshBPExport_MaterialInstancesCreated, STATGROUP_UEMeshBPExport, );
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Bytes Read"), STAT_UEMeshBPExport_BytesRead, STATGROUP_UEMeshBPExport, );
@@ -0,0 +1,413 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "UEMeshBenchmark.h"
+#include "UEMeshBPExportFuncs.h"
+
+#if WITH_EDITOR
+#include "UEMeshBPExportFuncsBPLibrary.h"
+#include "UEMeshTextureHashIndex.h"
+#include "Animation/SkeletalMeshActor.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "Components/InstancedStaticMeshComponent.h"
+#include "Engine/SkeletalMesh.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/Texture2D.h"
+#include "Engine/World.h"
+#include "Materials/Material.h"
+#include "Materials/MaterialInstanceConstant.h"
+#include "Materials/MaterialExpressionScalarParameter.h"
+#include "Materials/MaterialExpressionVectorParameter.h"
+#include "Materials/MaterialExpressionTextureSampleParameter2D.h"
+#include "MaterialEditingLibrary.h"
+#include "PackageTools.h"
+#include "UObject/Package.h"
+#include "UObject/UObjectIterator.h"
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformMemory.h"
+#include "HAL/PlatformTime.h"
+#include "Math/RandomStream.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "JsonObjectConverter.h"
+
+// Names of the texture parameters ImportMaterialFromJson binds, the synthetic parent material exposes them first
+static const TCHAR* BoundTextureParameterNames[] = { TEXT("BaseColorTexture"), TEXT("NormalTexture"), TEXT("RoughnessTexture"), TEXT("MetallicTexture") };
+
+// Helper function: Name of the texture parameter with the given index
+static FName GetBenchmarkTextureParameterName(int32 ParamIndex)
+{
+	return ParamIndex < UE_ARRAY_COUNT(BoundTextureParameterNames) ? FName(BoundTextureParameterNames[ParamIndex]) : FName(*FString::Printf(TEXT("Texture_%d"), ParamIndex));
+}
+
+// Objects generated for one run, rooted so a garbage collection during export or import cannot remove them
+struct FBenchmarkAssets
+{
+	FString ContentRoot;
+	UMaterial* ParentMaterial = nullptr;
+	TArray<UTexture2D*> Textures;
+	TArray<UMaterialInstanceConstant*> Materials;
+	TArray<USkeletalMesh*> Meshes;
+	TArray<UObject*> RootedObjects;
+
+	template <typename ObjectType>
+	ObjectType* Root(ObjectType* Object)
+	{
+		Object->AddToRoot();
+		RootedObjects.Add(Object);
+		return Object;
+	}
+};
+
+// Helper function: Memory use of the process in MiB
+static double GetUsedMemoryMB()
+{
+	return FPlatformMemory::GetStats().UsedPhysical / (1024.0 * 1024.0);
+}
+
+// Helper function: Create a texture with a gradient and noise pattern, so it compresses like real content rather than a flat color
+static UTexture2D* CreateBenchmarkTexture(const FString& ContentRoot, int32 Index, int32 Size)
+{
+	const FString AssetName = FString::Printf(TEXT("T_Bench_%d"), Index);
+	UPackage* Package = CreatePackage(*(ContentRoot / TEXT("Textures") / AssetName));
+	UTexture2D* Texture = NewObject<UTexture2D>(Package, *AssetName, RF_Public | RF_Standalone);
+
+	TArray64<uint8> Pixels;
+	Pixels.SetNumUninitialized((int64)Size * Size * 4);
+	FRandomStream Random(Index);
+	for (int32 Y = 0; Y < Size; Y++)
+	{
+		for (int32 X = 0; X < Size; X++)
+		{
+			uint8* Pixel = &Pixels[((int64)Y * Size + X) * 4];
+			Pixel[0] = (uint8)(X * 255 / Size);
+			Pixel[1] = (uint8)(Y * 255 / Size);
+			Pixel[2] = (uint8)Random.RandRange(0, 255);
+			Pixel[3] = 255;
+		}
+	}
+	Texture->Source.Init(Size, Size, 1, 1, TSF_BGRA8, Pixels.GetData());
+
+	return Texture;
+}
+
+// Helper function: Create the parent material exposing the configured number of scalar, vector and texture parameters
+static UMaterial* CreateBenchmarkParentMaterial(const FString& ContentRoot, const FUEMeshBenchmarkSettings& Settings)
+{
+	UPackage* Package = CreatePackage(*(ContentRoot / TEXT("Materials") / TEXT("M_BenchParent")));
+	UMaterial* Material = NewObject<UMaterial>(Package, TEXT("M_BenchParent"), RF_Public | RF_Standalone);
+
+	for (int32 ParamIndex = 0; ParamIndex < Settings.NumScalarParameters; ParamIndex++)
+	{
+		UMaterialExpressionScalarParameter* Expression = Cast<UMaterialExpressionScalarParameter>(UMaterialEditingLibrary::CreateMaterialExpression(Material, UMaterialExpressionScalarParameter::StaticClass()));
+		Expression->ParameterName = *FString::Printf(TEXT("Scalar_%d"), ParamIndex);
+	}
+
+	for (int32 ParamIndex = 0; ParamIndex < Settings.NumVectorParameters; ParamIndex++)
+	{
+		UMaterialExpressionVectorParameter* Expression = Cast<UMaterialExpressionVectorParameter>(UMaterialEditingLibrary::CreateMaterialExpression(Material, UMaterialExpressionVectorParameter::StaticClass()));
+		Expression->ParameterName = *FString::Printf(TEXT("Vector_%d"), ParamIndex);
+	}
+
+	UTexture* DefaultTexture = LoadObject<UTexture>(nullptr, TEXT("/Engine/EngineResources/DefaultTexture.DefaultTexture"));
+	UTexture* DefaultNormal = LoadObject<UTexture>(nullptr, TEXT("/Engine/EngineMaterials/DefaultNormal.DefaultNormal"));
+	for (int32 ParamIndex = 0; ParamIndex < Settings.NumTextureParameters; ParamIndex++)
+	{
+		UMaterialExpressionTextureSampleParameter2D* Expression = Cast<UMaterialExpressionTextureSampleParameter2D>(UMaterialEditingLibrary::CreateMaterialExpression(Material, UMaterialExpressionTextureSampleParameter2D::StaticClass()));
+		const bool bIsNormal = ParamIndex == 1;
+		Expression->ParameterName = GetBenchmarkTextureParameterName(ParamIndex);
+		Expression->SamplerType = bIsNormal ? SAMPLERTYPE_Normal : SAMPLERTYPE_Color;
+		Expression->Texture = bIsNormal ? DefaultNormal : DefaultTexture;
+	}
+
+	UMaterialEditingLibrary::RecompileMaterial(Material);
+	return Material;
+}
+
+// Helper function: Generate every asset of the data set
+static bool CreateBenchmarkAssets(const FUEMeshBenchmarkSettings& Settings, FBenchmarkAssets& OutAssets)
+{
+	USkeletalMesh* TemplateMesh = LoadObject<USkeletalMesh>(nullptr, TEXT("/Engine/EngineMeshes/SkeletalCube.SkeletalCube"));
+	if (!TemplateMesh)
+	{
+		UE_LOG(LogUEMeshBPExport, Error, TEXT("UEMeshBenchmark: Failed to load the template skeletal mesh"));
+		return false;
+	}
+
+	OutAssets.ParentMaterial = OutAssets.Root(CreateBenchmarkParentMaterial(OutAssets.ContentRoot, Settings));
+
+	for (int32 TextureIndex = 0; TextureIndex < Settings.NumTextures; TextureIndex++)
+	{
+		OutAssets.Textures.Add(OutAssets.Root(CreateBenchmarkTexture(OutAssets.ContentRoot, TextureIndex, Settings.TextureSize)));
+	}
+
+	FRandomStream Random(Settings.NumMaterials);
+	int32 NextTexture = 0;
+	for (int32 MaterialIndex = 0; MaterialIndex < Settings.NumMaterials; MaterialIndex++)
+	{
+		const FString AssetName = FString::Printf(TEXT("MI_Bench_%d"), MaterialIndex);
+		UPackage* Package = CreatePackage(*(OutAssets.ContentRoot / TEXT("Materials") / AssetName));
+		UMaterialInstanceConstant* Material = OutAssets.Root(NewObject<UMaterialInstanceConstant>(Package, *AssetName, RF_Public | RF_Standalone));
+		Material->SetParentEditorOnly(OutAssets.ParentMaterial);
+
+		for (int32 ParamIndex = 0; ParamIndex < Settings.NumScalarParameters; ParamIndex++)
+		{
+			Material->SetScalarParameterValueEditorOnly(FMaterialParameterInfo(*FString::Printf(TEXT("Scalar_%d"), ParamIndex)), Random.FRand());
+		}
+		for (int32 ParamIndex = 0; ParamIndex < Settings.NumVectorParameters; ParamIndex++)
+		{
+			Material->SetVectorParameterValueEditorOnly(FMaterialParameterInfo(*FString::Printf(TEXT("Vector_%d"), ParamIndex)), FLinearColor(Random.FRand(), Random.FRand(), Random.FRand(), 1.0f));
+		}
+		for (int32 ParamIndex = 0; ParamIndex < Settings.NumTextureParameters; ParamIndex++)
+		{
+			Material->SetTextureParameterValueEditorOnly(FMaterialParameterInfo(GetBenchmarkTextureParameterName(ParamIndex)), OutAssets.Textures[NextTexture++ % OutAssets.Textures.Num()]);
+		}
+
+		Material->PostEditChange();
+		OutAssets.Materials.Add(Material);
+	}
+
+	for (int32 MeshIndex = 0; MeshIndex < Settings.NumMeshes; MeshIndex++)
+	{
+		const FString AssetName = FString::Printf(TEXT("SK_Bench_%d"), MeshIndex);
+		UPackage* Package = CreatePackage(*(OutAssets.ContentRoot / TEXT("Meshes") / AssetName));
+		USkeletalMesh* Mesh = OutAssets.Root(DuplicateObject<USkeletalMesh>(TemplateMesh, Package, *AssetName));
+
+		// The FBX material is named after the material, naming the slot the same lets the import bind it again
+		UMaterialInstanceConstant* Material = OutAssets.Materials[MeshIndex % OutAssets.Materials.Num()];
+		for (FSkeletalMaterial& SkeletalMaterial : Mesh->GetMaterials())
+		{
+			SkeletalMaterial.MaterialInterface = Material;
+			SkeletalMaterial.MaterialSlotName = Material->GetFName();
+			SkeletalMaterial.ImportedMaterialSlotName = Material->GetFName();
+		}
+
+		OutAssets.Meshes.Add(Mesh);
+	}
+
+	return true;
+}
+
+// Helper function: Unload every package below ContentRoot, generated and imported alike
+static void UnloadBenchmarkPackages(const FString& ContentRoot)
+{
+	TArray<UPackage*> Packages;
+	for (TObjectIterator<UPackage> It; It; ++It)
+	{
+		if (It->GetName().StartsWith(ContentRoot))
+		{
+			Packages.Add(*It);
+		}
+	}
+
+	FText ErrorMessage;
+	if (Packages.Num() > 0 && !UPackageTools::UnloadPackages(Packages, ErrorMessage, true))
+	{
+		UE_LOG(LogUEMeshBPExport, Warning, TEXT("UEMeshBenchmark: Failed to unload benchmark packages: %s"), *ErrorMessage.ToString());
+	}
+}
+
+// Helper function: Append the report as one row of the results CSV shared by all runs
+static void AppendBenchmarkCsv(const FString& CsvPath, const FString& RunId, const FUEMeshBenchmarkReport& Report)
+{
+	const FUEMeshBenchmarkSettings& Settings = Report.Settings;
+	const FUEMeshExportStats& Stats = Report.ExportStats;
+
+	FString Csv;
+	if (!FPaths::FileExists(CsvPath))
+	{
+		Csv += TEXT("Run,Actors,Meshes,Materials,ScalarParams,VectorParams,TextureParams,Textures,TextureSize,")
+			TEXT("SetupSeconds,ExportSeconds,MeshExportSeconds,MaterialExportSeconds,TextureExportSeconds,ManifestWriteSeconds,")
+			TEXT("ImportSeconds,MeshImportSeconds,MaterialBindingSeconds,FilesWritten,BytesWritten,FilesImported,")
+			TEXT("ExportMemoryDeltaMB,ImportMemoryDeltaMB,PeakMemoryMB,StaticMeshInstances") LINE_TERMINATOR;
+	}
+
+	Csv += FString::Printf(TEXT("%s,%d,%d,%d,%d,%d,%d,%d,%d,%.4f,%.4f,%.4f,%.4f,%.4f,%.4f,%.4f,%.4f,%.4f,%d,%lld,%d,%.1f,%.1f,%.1f,%d") LINE_TERMINATOR,
+		*RunId, Settings.NumActors, Settings.NumMeshes, Settings.NumMaterials, Settings.NumScalarParameters, Settings.NumVectorParameters,
+		Settings.NumTextureParameters, Settings.NumTextures, Settings.TextureSize,
+		Report.SetupSeconds, Report.ExportSeconds, Stats.MeshExportSeconds, Stats.MaterialExportSeconds, Stats.TextureExportSeconds, Stats.ManifestWriteSeconds,
+		Report.ImportSeconds, Report.MeshImportSeconds, Report.MaterialBindingSeconds, Report.NumFilesWritten, Report.BytesWritten, Report.NumFilesImported,
+		Report.ExportMemoryDeltaMB, Report.ImportMemoryDeltaMB, Report.PeakMemoryMB, Settings.NumStaticMeshInstances);
+
+	FFileHelper::SaveStringToFile(Csv, *CsvPath, FFileHelper::EEncodingOptions::AutoDetect, &IFileManager::Get(), FILEWRITE_Append);
+}
+
+bool RunUEMeshBenchmark(const FUEMeshBenchmarkSettings& InSettings, FUEMeshBenchmarkReport& OutReport)
+{
+	// Assets are assigned round robin, every pool needs at least one entry
+	FUEMeshBenchmarkSettings Settings = InSettings;
+	Settings.NumActors = FMath::Max(1, Settings.NumActors);
+	Settings.NumMeshes = FMath::Max(1, Settings.NumMeshes);
+	Settings.NumMaterials = FMath::Max(1, Settings.NumMaterials);
+	Settings.NumTextures = FMath::Max(1, Settings.NumTextures);
+	Settings.NumScalarParameters = FMath::Max(0, Settings.NumScalarParameters);
+	Settings.NumVectorParameters = FMath::Max(0, Settings.NumVectorParameters);
+	Settings.NumTextureParameters = FMath::Max(0, Settings.NumTextureParameters);
+	Settings.TextureSize = FMath::Max(4, Settings.TextureSize);
+	Settings.NumStaticMeshInstances = FMath::Max(0, Settings.NumStaticMeshInstances);
+
+	OutReport = FUEMeshBenchmarkReport();
+	OutReport.Settings = Settings;
+
+	const FString RunId = FDateTime::Now().ToString(TEXT("%Y%m%d_%H%M%S"));
+	const FString BenchmarkRoot = FPaths::ProjectSavedDir() / TEXT("UEMeshBenchmark");
+	const FString OutputDirectory = Settings.OutputDirectory.IsEmpty() ? BenchmarkRoot / RunId : Settings.OutputDirectory;
+	const FString ExportDirectory = OutputDirectory / TEXT("Export");
+
+	// Unique per run, leftovers of an aborted run can never collide with new assets
+	FBenchmarkAssets Assets;
+	Assets.ContentRoot = FString::Printf(TEXT("/Game/__UEMeshBenchmark_%s"), *RunId);
+	const FString ImportRoot = Assets.ContentRoot + TEXT("_Import");
+
+	UE_LOG(LogUEMeshBPExport, Log, TEXT("UEMeshBenchmark: Generating %d meshes, %d materials, %d textures of %dx%d"),
+		Settings.NumMeshes, Settings.NumMaterials, Settings.NumTextures, Settings.TextureSize, Settings.TextureSize);
+
+	double StageStartTime = FPlatformTime::Seconds();
+	if (!CreateBenchmarkAssets(Settings, Assets))
+	{
+		return false;
+	}
+
+	UWorld* World = UWorld::CreateWorld(EWorldType::Inactive, false);
+	World->AddToRoot();
+
+	// Every actor places the same static mesh, the export should write it once no matter the number of instances
+	UStaticMesh* InstancedMesh = Settings.NumStaticMeshInstances > 0 ? LoadObject<UStaticMesh>(nullptr, TEXT("/Engine/BasicShapes/Cube.Cube")) : nullptr;
+	const int32 GridSize = FMath::CeilToInt(FMath::Sqrt((float)Settings.NumStaticMeshInstances));
+
+	TArray<AActor*> Actors;
+	for (int32 ActorIndex = 0; ActorIndex < Settings.NumActors; ActorIndex++)
+	{
+		FActorSpawnParameters SpawnParameters;
+		SpawnParameters.Name = *FString::Printf(TEXT("Bench_Actor_%d"), ActorIndex);
+		SpawnParameters.ObjectFlags = RF_Transient;
+		ASkeletalMeshActor* Actor = World->SpawnActor<ASkeletalMeshActor>(SpawnParameters);
+		Actor->GetSkeletalMeshComponent()->SetSkeletalMeshAsset(Assets.Meshes[ActorIndex % Assets.Meshes.Num()]);
+
+		if (InstancedMesh)
+		{
+			UInstancedStaticMeshComponent* InstancedComponent = NewObject<UInstancedStaticMeshComponent>(Actor, TEXT("Bench_Instances"), RF_Transient);
+			InstancedComponent->SetStaticMesh(InstancedMesh);
+			InstancedComponent->SetupAttachment(Actor->GetRootComponent());
+			InstancedComponent->RegisterComponent();
+			for (int32 InstanceIndex = 0; InstanceIndex < Settings.NumStaticMeshInstances; InstanceIndex++)
+			{
+				InstancedComponent->AddInstance(FTransform(FVector((InstanceIndex % GridSize) * 200.0, (InstanceIndex / GridSize) * 200.0, 0.0)));
+			}
+		}
+
+		Actors.Add(Actor);
+	}
+	OutReport.SetupSeconds = FPlatformTime::Seconds() - StageStartTime;
+
+	// Export, the binary manifest lets the import bind materials without a JSON per mesh
+	FUEMeshExportOptions ExportOptions;
+	ExportOptions.bWriteBinaryManifest = true;
+
+	double MemoryBefore = GetUsedMemoryMB();
+	StageStartTime = FPlatformTime::Seconds();
+	const bool bExported = UUEMeshBPExportFuncsBPLibrary::ExportSkelMeshesBatch(Actors, ExportDirectory, ExportOptions, OutReport.ExportStats);
+	OutReport.ExportSeconds = FPlatformTime::Seconds() - StageStartTime;
+	OutReport.ExportMemoryDeltaMB = GetUsedMemoryMB() - MemoryBefore;
+
+	IFileManager::Get().IterateDirectoryStatRecursively(*ExportDirectory, [&OutReport](const TCHAR* FilenameOrDirectory, const FFileStatData& StatData)
+	{
+		if (!StatData.bIsDirectory)
+		{
+			OutReport.NumFilesWritten++;
+			OutReport.BytesWritten += StatData.FileSize;
+		}
+		return true;
+	});
+
+	World->DestroyWorld(false);
+	World->RemoveFromRoot();
+
+	// Import every exported mesh file in one batch and bind its materials
+	if (bExported && Settings.bImport)
+	{
+		const FString RelativeMeshRoot = Assets.ContentRoot.RightChop(6) / TEXT("Meshes");
+		TArray<FString> MeshNames;
+		for (const USkeletalMesh* Mesh : Assets.Meshes)
+		{
+			MeshNames.Add(RelativeMeshRoot / Mesh->GetName() + TEXT(".fbx"));
+		}
+
+		// The imported textures are unloaded below and never saved, they go to a throwaway index instead of the project's
+		FUEMeshTextureHashIndex::Save();
+		FUEMeshTextureHashIndex::SetChangesFile(OutputDirectory / TEXT("TextureHashIndex.json"));
+
+		MemoryBefore = GetUsedMemoryMB();
+		StageStartTime = FPlatformTime::Seconds();
+		const TArray<FUEMeshImportResult> ImportResults = UUEMeshBPExportFuncsBPLibrary::ImportMeshes(ImportRoot, ExportDirectory, MeshNames, true, true, Assets.ParentMaterial, 1.0f, OutReport.ImportStats);
+		OutReport.ImportSeconds = FPlatformTime::Seconds() - StageStartTime;
+		OutReport.ImportMemoryDeltaMB = GetUsedMemoryMB() - MemoryBefore;
+
+		FUEMeshTextureHashIndex::Save();
+		FUEMeshTextureHashIndex::SetChangesFile(FString());
+		FUEMeshTextureHashIndex::Reload();
+
+		for (const FUEMeshImportResult& Result : ImportResults)
+		{
+			OutReport.NumFilesImported += Result.bSuccess ? 1 : 0;
+			OutReport.MeshImportSeconds += Result.ImportSeconds;
+			OutReport.MaterialBindingSeconds += Result.MaterialSeconds;
+		}
+	}
+
+	// Remove everything the run created
+	for (UObject* Object : Assets.RootedObjects)
+	{
+		Object->RemoveFromRoot();
+	}
+	UnloadBenchmarkPackages(Assets.ContentRoot);
+	if (!Settings.bKeepFiles)
+	{
+		IFileManager::Get().DeleteDirectory(*ExportDirectory, false, true);
+	}
+
+	OutReport.PeakMemoryMB = FPlatformMemory::GetStats().PeakUsedPhysical / (1024.0 * 1024.0);
+
+	FString ReportJson;
+	if (FJsonObjectConverter::UStructToJsonObjectString(OutReport, ReportJson))
+	{
+		FFileHelper::SaveStringToFile(ReportJson, *(OutputDirectory / TEXT("Report.json")));
+	}
+	AppendBenchmarkCsv(BenchmarkRoot / TEXT("Results.csv"), RunId, OutReport);
+
+	UE_LOG(LogUEMeshBPExport, Log, TEXT("UEMeshBenchmark: Setup %.2fs, Export %.2fs (%d files, %lld bytes), Import %.2fs (mesh %.2fs, material %.2fs, %d files)"),
+		OutReport.SetupSeconds, OutReport.ExportSeconds, OutReport.NumFilesWritten, OutReport.BytesWritten,
+		OutReport.ImportSeconds, OutReport.MeshImportSeconds, OutReport.MaterialBindingSeconds, OutReport.NumFilesImported);
+	UE_LOG(LogUEMeshBPExport, Log, TEXT("UEMeshBenchmark: Report written to %s"), *OutputDirectory);
+
+	return bExported && (!Settings.bImport || OutReport.NumFilesImported == Settings.NumMeshes);
+}
+
+// Helper function: Console entry point, arguments are Key=Value pairs named after the settings
+static void RunUEMeshBenchmarkCommand(const TArray<FString>& Args)
+{
+	const FString ArgString = FString::Join(Args, TEXT(" "));
+
+	FUEMeshBenchmarkSettings Settings;
+	FParse::Value(*ArgString, TEXT("Actors="), Settings.NumActors);
+	FParse::Value(*ArgString, TEXT("Meshes="), Settings.NumMeshes);
+	FParse::Value(*ArgString, TEXT("Materials="), Settings.NumMaterials);
+	FParse::Value(*ArgString, TEXT("Scalars="), Settings.NumScalarParameters);
+	FParse::Value(*ArgString, TEXT("Vectors="), Settings.NumVectorParameters);
+	FParse::Value(*ArgString, TEXT("TextureParams="), Settings.NumTextureParameters);
+	FParse::Value(*ArgString, TEXT("Textures="), Settings.NumTextures);
+	FParse::Value(*ArgString, TEXT("TextureSize="), Settings.TextureSize);
+	FParse::Value(*ArgString, TEXT("Instances="), Settings.NumStaticMeshInstances);
+	FParse::Value(*ArgString, TEXT("Output="), Settings.OutputDirectory);
+	Settings.bImport = !Args.Contains(TEXT("NoImport"));
+	Settings.bKeepFiles = Args.Contains(TEXT("KeepFiles"));
+
+	FUEMeshBenchmarkReport Report;
+	RunUEMeshBenchmark(Settings, Report);
+}
+
+static FAutoConsoleCommand UEMeshBenchmarkCommand(
+	TEXT("UEMeshBPExport.Benchmark"),
+	TEXT("Benchmarks export and import on synthetic assets. Arguments: Actors= Meshes= Materials= Scalars= Vectors= TextureParams= Textures= TextureSize= Output= NoImport KeepFiles"),
+	FConsoleCommandWithArgsDelegate::CreateStatic(&RunUEMeshBenchmarkCommand));
+#endif
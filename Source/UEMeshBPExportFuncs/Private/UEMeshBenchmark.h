@@ -0,0 +1,22 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UEMeshBPExportFuncsTypes.h"
+
+#if WITH_EDITOR
+/*
+*	End-to-end benchmark of the export and import entry points on a synthetic data set.
+*	Generates skeletal meshes, material instances and textures in memory, exports them with ExportSkelMeshesBatch,
+*	imports the result with ImportMeshes and binds the materials, then removes every generated and imported asset again.
+*
+*	Each run writes <OutputDirectory>/Report.json and appends one row to <Project>/Saved/UEMeshBenchmark/Results.csv,
+*	so results can be compared across changes. Headless runs use the automation tests of the UEMeshBPExportFuncsTests module,
+*	UnrealEditor-Cmd <Project> -nullrhi -unattended -ExecCmds="Automation RunTests UEMeshBPExport;Quit", or the console command
+*	for other sizes, e.g. -ExecCmds="UEMeshBPExport.Benchmark Meshes=64 TextureSize=1024,Quit"
+*
+*	Textures imported by a run are recorded in <OutputDirectory>/TextureHashIndex.json, not in the index of the project.
+*/
+bool RunUEMeshBenchmark(const FUEMeshBenchmarkSettings& Settings, FUEMeshBenchmarkReport& OutReport);
+#endif
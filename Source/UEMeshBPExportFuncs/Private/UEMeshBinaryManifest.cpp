@@ -0,0 +1,430 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "UEMeshBinaryManifest.h"
+
+#include "HAL/FileManager.h"
+#include "HAL/PlatformFileManager.h"
+#include "Async/MappedFileHandle.h"
+#include "Misc/FileHelper.h"
+#include "Templates/UniquePtr.h"
+
+const TCHAR* FUEMeshBinaryManifest::FileName = TEXT("manifest.umbm");
+
+static_assert(sizeof(FUEMeshBinaryManifestHeader) == 96, "Binary manifest header layout changed, bump FUEMeshBinaryManifest::Version");
+static_assert(sizeof(FUEMeshBinaryMaterial) == 36 && sizeof(FUEMeshBinaryMesh) == 28 && sizeof(FUEMeshBinaryLOD) == 16 && sizeof(FUEMeshBinaryActor) == 16, "Binary manifest record layout changed, bump FUEMeshBinaryManifest::Version");
+
+namespace
+{
+	// Read access to the sections of a validated manifest, every index is bounds checked
+	class FManifestView
+	{
+	public:
+		FManifestView(const uint8* InData)
+			: Data(InData)
+			, Header(*reinterpret_cast<const FUEMeshBinaryManifestHeader*>(InData))
+		{
+		}
+
+		template <typename RecordType>
+		TConstArrayView<RecordType> GetSection(const FUEMeshBinarySection& Section) const
+		{
+			return TConstArrayView<RecordType>(reinterpret_cast<const RecordType*>(Data + Section.Offset), Section.Count);
+		}
+
+		bool GetString(uint32 Index, FString& OutString) const
+		{
+			const TConstArrayView<FUEMeshBinaryString> Strings = GetSection<FUEMeshBinaryString>(Header.Strings);
+			if (!Strings.IsValidIndex(Index))
+			{
+				return false;
+			}
+
+			const FUEMeshBinaryString& String = Strings[Index];
+			if ((uint64)String.Offset + String.Length > Header.StringData.Count)
+			{
+				return false;
+			}
+
+			const FUTF8ToTCHAR Converted(reinterpret_cast<const ANSICHAR*>(Data + Header.StringData.Offset + String.Offset), String.Length);
+			OutString = FString(Converted.Length(), Converted.Get());
+			return true;
+		}
+
+		const uint8* Data;
+		const FUEMeshBinaryManifestHeader& Header;
+	};
+
+	// Helper function: True if [First, First + Num) lies inside an array of Count records
+	bool IsValidRange(uint32 First, uint32 Num, uint32 Count)
+	{
+		return (uint64)First + Num <= Count;
+	}
+
+	// Collects the string table and the flat record arrays while saving
+	struct FManifestBuilder
+	{
+		TMap<FString, uint32> StringIndices;
+		TArray<FUEMeshBinaryString> Strings;
+		TArray<uint8> StringData;
+		TArray<FUEMeshBinaryMaterial> Materials;
+		TArray<FUEMeshBinaryScalarParameter> ScalarParameters;
+		TArray<FUEMeshBinaryVectorParameter> VectorParameters;
+		TArray<FUEMeshBinaryTextureParameter> TextureParameters;
+		TArray<FUEMeshBinaryMesh> Meshes;
+		TArray<FUEMeshBinaryMaterialRef> MaterialRefs;
+		TArray<FUEMeshBinaryLOD> LODs;
+		TArray<FUEMeshBinaryActor> Actors;
+		TArray<uint32> ActorMeshes;
+
+		uint32 AddString(const FString& String)
+		{
+			if (const uint32* ExistingIndex = StringIndices.Find(String))
+			{
+				return *ExistingIndex;
+			}
+
+			const FTCHARToUTF8 Converted(*String, String.Len());
+			FUEMeshBinaryString& Entry = Strings.AddDefaulted_GetRef();
+			Entry.Offset = StringData.Num();
+			Entry.Length = Converted.Length();
+			StringData.Append(reinterpret_cast<const uint8*>(Converted.Get()), Converted.Length());
+
+			return StringIndices.Add(String, Strings.Num() - 1);
+		}
+	};
+
+	// Helper function: Place a section at the current end of the file, 4-byte aligned
+	template <typename RecordType>
+	FUEMeshBinarySection PlaceSection(const TArray<RecordType>& Records, uint32& InOutFileSize)
+	{
+		FUEMeshBinarySection Section;
+		Section.Offset = Align(InOutFileSize, 4);
+		Section.Count = Records.Num();
+		InOutFileSize = Section.Offset + Records.Num() * sizeof(RecordType);
+		return Section;
+	}
+
+	// Helper function: Write a section at the offset reserved by PlaceSection
+	template <typename RecordType>
+	void WriteSection(FArchive& Ar, const FUEMeshBinarySection& Section, const TArray<RecordType>& Records)
+	{
+		static const uint8 Padding[4] = { 0, 0, 0, 0 };
+		Ar.Serialize(const_cast<uint8*>(Padding), Section.Offset - Ar.Tell());
+		Ar.Serialize(const_cast<RecordType*>(Records.GetData()), Records.Num() * sizeof(RecordType));
+	}
+}
+
+bool FUEMeshBinaryManifest::Validate(const uint8* Data, int64 DataSize)
+{
+	if (!Data || DataSize < (int64)sizeof(FUEMeshBinaryManifestHeader))
+	{
+		return false;
+	}
+
+	const FUEMeshBinaryManifestHeader& Header = *reinterpret_cast<const FUEMeshBinaryManifestHeader*>(Data);
+	if (Header.Magic != Magic || Header.Version != Version)
+	{
+		return false;
+	}
+
+	auto IsValidSection = [DataSize](const FUEMeshBinarySection& Section, uint32 RecordSize)
+	{
+		return Section.Offset % 4 == 0 && (uint64)Section.Offset + (uint64)Section.Count * RecordSize <= (uint64)DataSize;
+	};
+
+	return IsValidSection(Header.Strings, sizeof(FUEMeshBinaryString))
+		&& IsValidSection(Header.StringData, 1)
+		&& IsValidSection(Header.Materials, sizeof(FUEMeshBinaryMaterial))
+		&& IsValidSection(Header.ScalarParameters, sizeof(FUEMeshBinaryScalarParameter))
+		&& IsValidSection(Header.VectorParameters, sizeof(FUEMeshBinaryVectorParameter))
+		&& IsValidSection(Header.TextureParameters, sizeof(FUEMeshBinaryTextureParameter))
+		&& IsValidSection(Header.Meshes, sizeof(FUEMeshBinaryMesh))
+		&& IsValidSection(Header.MaterialRefs, sizeof(FUEMeshBinaryMaterialRef))
+		&& IsValidSection(Header.LODs, sizeof(FUEMeshBinaryLOD))
+		&& IsValidSection(Header.Actors, sizeof(FUEMeshBinaryActor))
+		&& IsValidSection(Header.ActorMeshes, sizeof(uint32));
+}
+
+bool FUEMeshBinaryManifest::Load(const FString& FilePath)
+{
+	Materials.Reset();
+	Meshes.Reset();
+	Actors.Reset();
+
+	// Map the file where possible, otherwise fall back to reading it into memory
+	TUniquePtr<IMappedFileHandle> MappedFile(FPlatformFileManager::Get().GetPlatformFile().OpenMapped(*FilePath));
+	TUniquePtr<IMappedFileRegion> MappedRegion(MappedFile ? MappedFile->MapRegion() : nullptr);
+
+	TArray64<uint8> FileData;
+	const uint8* Data = nullptr;
+	int64 DataSize = 0;
+	if (MappedRegion)
+	{
+		Data = MappedRegion->GetMappedPtr();
+		DataSize = MappedRegion->GetMappedSize();
+	}
+	else if (FFileHelper::LoadFileToArray(FileData, *FilePath, FILEREAD_Silent))
+	{
+		Data = FileData.GetData();
+		DataSize = FileData.Num();
+	}
+
+	if (!Validate(Data, DataSize))
+	{
+		return false;
+	}
+
+	const FManifestView View(Data);
+	const TConstArrayView<FUEMeshBinaryMaterial> MaterialRecords = View.GetSection<FUEMeshBinaryMaterial>(View.Header.Materials);
+	const TConstArrayView<FUEMeshBinaryScalarParameter> ScalarRecords = View.GetSection<FUEMeshBinaryScalarParameter>(View.Header.ScalarParameters);
+	const TConstArrayView<FUEMeshBinaryVectorParameter> VectorRecords = View.GetSection<FUEMeshBinaryVectorParameter>(View.Header.VectorParameters);
+	const TConstArrayView<FUEMeshBinaryTextureParameter> TextureRecords = View.GetSection<FUEMeshBinaryTextureParameter>(View.Header.TextureParameters);
+	const TConstArrayView<FUEMeshBinaryMesh> MeshRecords = View.GetSection<FUEMeshBinaryMesh>(View.Header.Meshes);
+	const TConstArrayView<FUEMeshBinaryMaterialRef> MaterialRefRecords = View.GetSection<FUEMeshBinaryMaterialRef>(View.Header.MaterialRefs);
+	const TConstArrayView<FUEMeshBinaryLOD> LODRecords = View.GetSection<FUEMeshBinaryLOD>(View.Header.LODs);
+	const TConstArrayView<FUEMeshBinaryActor> ActorRecords = View.GetSection<FUEMeshBinaryActor>(View.Header.Actors);
+	const TConstArrayView<uint32> ActorMeshIndices = View.GetSection<uint32>(View.Header.ActorMeshes);
+
+	TArray<FString> MaterialKeys;
+	MaterialKeys.Reserve(MaterialRecords.Num());
+	Materials.Reserve(MaterialRecords.Num());
+	for (const FUEMeshBinaryMaterial& Record : MaterialRecords)
+	{
+		FString JsonPath;
+		FMaterial Material;
+		if (!View.GetString(Record.JsonPath, JsonPath) || !View.GetString(Record.Name, Material.Name) || !View.GetString(Record.AssetPath, Material.AssetPath)
+			|| !IsValidRange(Record.FirstScalar, Record.NumScalars, ScalarRecords.Num())
+			|| !IsValidRange(Record.FirstVector, Record.NumVectors, VectorRecords.Num())
+			|| !IsValidRange(Record.FirstTexture, Record.NumTextures, TextureRecords.Num()))
+		{
+			return false;
+		}
+
+		for (const FUEMeshBinaryScalarParameter& Scalar : ScalarRecords.Slice(Record.FirstScalar, Record.NumScalars))
+		{
+			TPair<FString, float>& Parameter = Material.ScalarParameters.Emplace_GetRef(FString(), Scalar.Value);
+			if (!View.GetString(Scalar.Name, Parameter.Key))
+			{
+				return false;
+			}
+		}
+
+		for (const FUEMeshBinaryVectorParameter& Vector : VectorRecords.Slice(Record.FirstVector, Record.NumVectors))
+		{
+			TPair<FString, FLinearColor>& Parameter = Material.VectorParameters.Emplace_GetRef(FString(), FLinearColor(Vector.R, Vector.G, Vector.B, Vector.A));
+			if (!View.GetString(Vector.Name, Parameter.Key))
+			{
+				return false;
+			}
+		}
+
+		for (const FUEMeshBinaryTextureParameter& Texture : TextureRecords.Slice(Record.FirstTexture, Record.NumTextures))
+		{
+			FTextureParameter& Parameter = Material.TextureParameters.AddDefaulted_GetRef();
+			if (!View.GetString(Texture.ParameterName, Parameter.ParameterName) || !View.GetString(Texture.TextureAssetPath, Parameter.TextureAssetPath)
+				|| !View.GetString(Texture.ExportedPath, Parameter.ExportedPath))
+			{
+				return false;
+			}
+		}
+
+		MaterialKeys.Add(JsonPath);
+		Materials.Add(MoveTemp(JsonPath), MoveTemp(Material));
+	}
+
+	TArray<FString> MeshKeys;
+	MeshKeys.Reserve(MeshRecords.Num());
+	Meshes.Reserve(MeshRecords.Num());
+	for (const FUEMeshBinaryMesh& Record : MeshRecords)
+	{
+		FString ExportedPath;
+		FMesh Mesh;
+		if (!View.GetString(Record.ExportedPath, ExportedPath) || !View.GetString(Record.MeshName, Mesh.MeshName) || !View.GetString(Record.MeshAssetPath, Mesh.MeshAssetPath)
+			|| !IsValidRange(Record.FirstMaterialRef, Record.NumMaterialRefs, MaterialRefRecords.Num())
+			|| !IsValidRange(Record.FirstLOD, Record.NumLODs, LODRecords.Num()))
+		{
+			return false;
+		}
+
+		for (const FUEMeshBinaryMaterialRef& MaterialRefRecord : MaterialRefRecords.Slice(Record.FirstMaterialRef, Record.NumMaterialRefs))
+		{
+			FMaterialRef& MaterialRef = Mesh.MaterialRefs.AddDefaulted_GetRef();
+			MaterialRef.SlotIndex = MaterialRefRecord.SlotIndex;
+			if (!View.GetString(MaterialRefRecord.SlotName, MaterialRef.SlotName))
+			{
+				return false;
+			}
+			if (MaterialRefRecord.Material != InvalidIndex)
+			{
+				if (!MaterialKeys.IsValidIndex(MaterialRefRecord.Material))
+				{
+					return false;
+				}
+				MaterialRef.MaterialJsonPath = MaterialKeys[MaterialRefRecord.Material];
+			}
+		}
+
+		for (const FUEMeshBinaryLOD& LODRecord : LODRecords.Slice(Record.FirstLOD, Record.NumLODs))
+		{
+			FLOD& LOD = Mesh.LODs.AddDefaulted_GetRef();
+			LOD.ScreenSize = LODRecord.ScreenSize;
+			LOD.NumVertices = LODRecord.NumVertices;
+			LOD.NumTriangles = LODRecord.NumTriangles;
+			if (!View.GetString(LODRecord.ExportedPath, LOD.ExportedPath))
+			{
+				return false;
+			}
+		}
+
+		MeshKeys.Add(ExportedPath);
+		Meshes.Add(MoveTemp(ExportedPath), MoveTemp(Mesh));
+	}
+
+	Actors.Reserve(ActorRecords.Num());
+	for (const FUEMeshBinaryActor& Record : ActorRecords)
+	{
+		FString ManifestName;
+		FActor Actor;
+		if (!View.GetString(Record.ManifestName, ManifestName) || !View.GetString(Record.ActorName, Actor.ActorName)
+			|| !IsValidRange(Record.FirstMesh, Record.NumMeshes, ActorMeshIndices.Num()))
+		{
+			return false;
+		}
+
+		for (uint32 MeshIndex : ActorMeshIndices.Slice(Record.FirstMesh, Record.NumMeshes))
+		{
+			if (!MeshKeys.IsValidIndex(MeshIndex))
+			{
+				return false;
+			}
+			Actor.MeshPaths.Add(MeshKeys[MeshIndex]);
+		}
+
+		Actors.Add(MoveTemp(ManifestName), MoveTemp(Actor));
+	}
+
+	return true;
+}
+
+bool FUEMeshBinaryManifest::Save(const FString& FilePath) const
+{
+	FManifestBuilder Builder;
+
+	TMap<FString, uint32> MaterialIndices;
+	for (const TPair<FString, FMaterial>& MaterialPair : Materials)
+	{
+		const FMaterial& Material = MaterialPair.Value;
+
+		FUEMeshBinaryMaterial& Record = Builder.Materials.AddDefaulted_GetRef();
+		Record.JsonPath = Builder.AddString(MaterialPair.Key);
+		Record.Name = Builder.AddString(Material.Name);
+		Record.AssetPath = Builder.AddString(Material.AssetPath);
+
+		Record.FirstScalar = Builder.ScalarParameters.Num();
+		Record.NumScalars = Material.ScalarParameters.Num();
+		for (const TPair<FString, float>& Parameter : Material.ScalarParameters)
+		{
+			Builder.ScalarParameters.Add({ Builder.AddString(Parameter.Key), Parameter.Value });
+		}
+
+		Record.FirstVector = Builder.VectorParameters.Num();
+		Record.NumVectors = Material.VectorParameters.Num();
+		for (const TPair<FString, FLinearColor>& Parameter : Material.VectorParameters)
+		{
+			Builder.VectorParameters.Add({ Builder.AddString(Parameter.Key), Parameter.Value.R, Parameter.Value.G, Parameter.Value.B, Parameter.Value.A });
+		}
+
+		Record.FirstTexture = Builder.TextureParameters.Num();
+		Record.NumTextures = Material.TextureParameters.Num();
+		for (const FTextureParameter& Parameter : Material.TextureParameters)
+		{
+			Builder.TextureParameters.Add({ Builder.AddString(Parameter.ParameterName), Builder.AddString(Parameter.TextureAssetPath), Builder.AddString(Parameter.ExportedPath) });
+		}
+
+		MaterialIndices.Add(MaterialPair.Key, Builder.Materials.Num() - 1);
+	}
+
+	TMap<FString, uint32> MeshIndices;
+	for (const TPair<FString, FMesh>& MeshPair : Meshes)
+	{
+		const FMesh& Mesh = MeshPair.Value;
+
+		FUEMeshBinaryMesh& Record = Builder.Meshes.AddDefaulted_GetRef();
+		Record.MeshName = Builder.AddString(Mesh.MeshName);
+		Record.MeshAssetPath = Builder.AddString(Mesh.MeshAssetPath);
+		Record.ExportedPath = Builder.AddString(MeshPair.Key);
+		Record.FirstMaterialRef = Builder.MaterialRefs.Num();
+		Record.NumMaterialRefs = Mesh.MaterialRefs.Num();
+
+		for (const FMaterialRef& MaterialRef : Mesh.MaterialRefs)
+		{
+			const uint32* MaterialIndex = MaterialIndices.Find(MaterialRef.MaterialJsonPath);
+			Builder.MaterialRefs.Add({ MaterialRef.SlotIndex, Builder.AddString(MaterialRef.SlotName), MaterialIndex ? *MaterialIndex : InvalidIndex });
+		}
+
+		Record.FirstLOD = Builder.LODs.Num();
+		Record.NumLODs = Mesh.LODs.Num();
+		for (const FLOD& LOD : Mesh.LODs)
+		{
+			Builder.LODs.Add({ Builder.AddString(LOD.ExportedPath), LOD.ScreenSize, (uint32)LOD.NumVertices, (uint32)LOD.NumTriangles });
+		}
+
+		MeshIndices.Add(MeshPair.Key, Builder.Meshes.Num() - 1);
+	}
+
+	for (const TPair<FString, FActor>& ActorPair : Actors)
+	{
+		FUEMeshBinaryActor& Record = Builder.Actors.AddDefaulted_GetRef();
+		Record.ManifestName = Builder.AddString(ActorPair.Key);
+		Record.ActorName = Builder.AddString(ActorPair.Value.ActorName);
+		Record.FirstMesh = Builder.ActorMeshes.Num();
+
+		for (const FString& MeshPath : ActorPair.Value.MeshPaths)
+		{
+			if (const uint32* MeshIndex = MeshIndices.Find(MeshPath))
+			{
+				Builder.ActorMeshes.Add(*MeshIndex);
+			}
+		}
+		Record.NumMeshes = Builder.ActorMeshes.Num() - Record.FirstMesh;
+	}
+
+	// Lay the sections out behind the header in the documented order
+	FUEMeshBinaryManifestHeader Header;
+	Header.Magic = Magic;
+	Header.Version = Version;
+
+	uint32 FileSize = sizeof(FUEMeshBinaryManifestHeader);
+	Header.Strings = PlaceSection(Builder.Strings, FileSize);
+	Header.StringData = PlaceSection(Builder.StringData, FileSize);
+	Header.Materials = PlaceSection(Builder.Materials, FileSize);
+	Header.ScalarParameters = PlaceSection(Builder.ScalarParameters, FileSize);
+	Header.VectorParameters = PlaceSection(Builder.VectorParameters, FileSize);
+	Header.TextureParameters = PlaceSection(Builder.TextureParameters, FileSize);
+	Header.Meshes = PlaceSection(Builder.Meshes, FileSize);
+	Header.MaterialRefs = PlaceSection(Builder.MaterialRefs, FileSize);
+	Header.LODs = PlaceSection(Builder.LODs, FileSize);
+	Header.Actors = PlaceSection(Builder.Actors, FileSize);
+	Header.ActorMeshes = PlaceSection(Builder.ActorMeshes, FileSize);
+
+	TUniquePtr<FArchive> FileWriter(IFileManager::Get().CreateFileWriter(*FilePath));
+	if (!FileWriter)
+	{
+		return false;
+	}
+
+	FileWriter->Serialize(&Header, sizeof(Header));
+	WriteSection(*FileWriter, Header.Strings, Builder.Strings);
+	WriteSection(*FileWriter, Header.StringData, Builder.StringData);
+	WriteSection(*FileWriter, Header.Materials, Builder.Materials);
+	WriteSection(*FileWriter, Header.ScalarParameters, Builder.ScalarParameters);
+	WriteSection(*FileWriter, Header.VectorParameters, Builder.VectorParameters);
+	WriteSection(*FileWriter, Header.TextureParameters, Builder.TextureParameters);
+	WriteSection(*FileWriter, Header.Meshes, Builder.Meshes);
+	WriteSection(*FileWriter, Header.MaterialRefs, Builder.MaterialRefs);
+	WriteSection(*FileWriter, Header.LODs, Builder.LODs);
+	WriteSection(*FileWriter, Header.Actors, Builder.Actors);
+	WriteSection(*FileWriter, Header.ActorMeshes, Builder.ActorMeshes);
+
+	return FileWriter->Close();
+}
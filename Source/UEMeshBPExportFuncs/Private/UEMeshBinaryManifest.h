@@ -0,0 +1,206 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/*
+*	Compact binary form of every actor and material manifest of an export root, stored as <ExportRoot>/manifest.umbm.
+*
+*	The file is a header followed by flat arrays of fixed-size little-endian records, all 4-byte aligned, so a reader can
+*	memory-map it and index the records in place. Every string is stored once in a UTF-8 string table and referenced by
+*	its index, ranges of child records are stored as first index + count:
+*
+*		Header
+*		Strings				FUEMeshBinaryString[]			offset/length into StringData
+*		StringData			uint8[]							UTF-8, not null-terminated
+*		Materials			FUEMeshBinaryMaterial[]
+*		ScalarParameters	FUEMeshBinaryScalarParameter[]
+*		VectorParameters	FUEMeshBinaryVectorParameter[]
+*		TextureParameters	FUEMeshBinaryTextureParameter[]
+*		Meshes				FUEMeshBinaryMesh[]				unique per exported mesh file
+*		MaterialRefs		FUEMeshBinaryMaterialRef[]
+*		LODs				FUEMeshBinaryLOD[]				only for meshes exported with bExportLODs
+*		Actors				FUEMeshBinaryActor[]
+*		ActorMeshes			uint32[]						mesh indices of the actors
+*/
+
+struct FUEMeshBinarySection
+{
+	uint32 Offset = 0;
+	uint32 Count = 0;
+};
+
+struct FUEMeshBinaryManifestHeader
+{
+	uint32 Magic = 0;
+	uint32 Version = 0;
+	FUEMeshBinarySection Strings;
+	FUEMeshBinarySection StringData;
+	FUEMeshBinarySection Materials;
+	FUEMeshBinarySection ScalarParameters;
+	FUEMeshBinarySection VectorParameters;
+	FUEMeshBinarySection TextureParameters;
+	FUEMeshBinarySection Meshes;
+	FUEMeshBinarySection MaterialRefs;
+	FUEMeshBinarySection LODs;
+	FUEMeshBinarySection Actors;
+	FUEMeshBinarySection ActorMeshes;
+};
+
+struct FUEMeshBinaryString
+{
+	uint32 Offset;
+	uint32 Length;
+};
+
+struct FUEMeshBinaryMaterial
+{
+	/** Path of the material JSON relative to the export root, identifies the material */
+	uint32 JsonPath;
+	uint32 Name;
+	uint32 AssetPath;
+	uint32 FirstScalar;
+	uint32 NumScalars;
+	uint32 FirstVector;
+	uint32 NumVectors;
+	uint32 FirstTexture;
+	uint32 NumTextures;
+};
+
+struct FUEMeshBinaryScalarParameter
+{
+	uint32 Name;
+	float Value;
+};
+
+struct FUEMeshBinaryVectorParameter
+{
+	uint32 Name;
+	float R;
+	float G;
+	float B;
+	float A;
+};
+
+struct FUEMeshBinaryTextureParameter
+{
+	uint32 ParameterName;
+	uint32 TextureAssetPath;
+	/** Path of the exported image relative to the export root */
+	uint32 ExportedPath;
+};
+
+struct FUEMeshBinaryMesh
+{
+	uint32 MeshName;
+	uint32 MeshAssetPath;
+	/** Path of the exported mesh file relative to the export root, identifies the mesh */
+	uint32 ExportedPath;
+	uint32 FirstMaterialRef;
+	uint32 NumMaterialRefs;
+	uint32 FirstLOD;
+	uint32 NumLODs;
+};
+
+struct FUEMeshBinaryMaterialRef
+{
+	int32 SlotIndex;
+	uint32 SlotName;
+	/** Index into Materials, InvalidIndex if the slot material could not be exported */
+	uint32 Material;
+};
+
+struct FUEMeshBinaryLOD
+{
+	/** Path of the file holding the LOD relative to the export root, the mesh file itself for FBX and LOD 0 */
+	uint32 ExportedPath;
+	float ScreenSize;
+	uint32 NumVertices;
+	uint32 NumTriangles;
+};
+
+struct FUEMeshBinaryActor
+{
+	/** Name of the JSON manifest the actor was written to, identifies the actor */
+	uint32 ManifestName;
+	uint32 ActorName;
+	uint32 FirstMesh;
+	uint32 NumMeshes;
+};
+
+/*
+*	In-memory form of a binary manifest. Records are keyed by the same relative paths the JSON manifests use,
+*	so a session can load the manifest of a previous export, replace what it exported again and save the result.
+*/
+class FUEMeshBinaryManifest
+{
+public:
+	static constexpr uint32 Magic = 0x4D424D55; // "UMBM"
+	static constexpr uint32 Version = 2;
+	static constexpr uint32 InvalidIndex = MAX_uint32;
+
+	/** File name of the binary manifest inside an export root */
+	static const TCHAR* FileName;
+
+	struct FTextureParameter
+	{
+		FString ParameterName;
+		FString TextureAssetPath;
+		FString ExportedPath;
+	};
+
+	struct FMaterial
+	{
+		FString Name;
+		FString AssetPath;
+		TArray<TPair<FString, float>> ScalarParameters;
+		TArray<TPair<FString, FLinearColor>> VectorParameters;
+		TArray<FTextureParameter> TextureParameters;
+	};
+
+	struct FMaterialRef
+	{
+		int32 SlotIndex = INDEX_NONE;
+		FString SlotName;
+		/** Key of the material in Materials, empty if the slot material could not be exported */
+		FString MaterialJsonPath;
+	};
+
+	struct FLOD
+	{
+		FString ExportedPath;
+		float ScreenSize = 0.0f;
+		int32 NumVertices = 0;
+		int32 NumTriangles = 0;
+	};
+
+	struct FMesh
+	{
+		FString MeshName;
+		FString MeshAssetPath;
+		TArray<FMaterialRef> MaterialRefs;
+		TArray<FLOD> LODs;
+	};
+
+	struct FActor
+	{
+		FString ActorName;
+		/** Keys of the actor meshes in Meshes */
+		TArray<FString> MeshPaths;
+	};
+
+	/** Materials by JSON path, meshes by exported file path and actors by manifest name, all relative to the export root */
+	TMap<FString, FMaterial> Materials;
+	TMap<FString, FMesh> Meshes;
+	TMap<FString, FActor> Actors;
+
+	/** Reads a binary manifest, memory-mapping it where the platform allows. Returns false if missing or invalid. */
+	bool Load(const FString& FilePath);
+
+	/** Writes all records into FilePath */
+	bool Save(const FString& FilePath) const;
+
+	/** Checks the header and that every section lies inside Data */
+	static bool Validate(const uint8* Data, int64 DataSize);
+};
@@ -0,0 +1,163 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "UEMeshDirectoryScanner.h"
+#include "UEMeshBPExportFuncs.h"
+#include "UEMeshBPExportFuncsStats.h"
+#include "HAL/PlatformFileManager.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeLock.h"
+#include "Async/ParallelFor.h"
+
+FCriticalSection FUEMeshDirectoryScanner::CacheLock;
+TMap<FString, TSharedPtr<const FUEMeshDirectoryScanner::FDirectoryListing>> FUEMeshDirectoryScanner::Cache;
+
+// Helper function: Turn "*.fbx", ".fbx" and "fbx" into "fbx", returns an empty string for a match-all filter
+static FString NormalizeExtensionFilter(const FString& Filter)
+{
+	FString Extension = Filter.TrimStartAndEnd();
+	Extension.RemoveFromStart(TEXT("*"));
+	Extension.RemoveFromStart(TEXT("."));
+	return Extension == TEXT("*") ? FString() : Extension;
+}
+
+// Helper function: Check a file name against the normalized extension filters
+static bool MatchesExtension(const FString& FileName, const TArray<FString>& Extensions)
+{
+	if (Extensions.Num() == 0)
+	{
+		return true;
+	}
+
+	int32 DotIndex;
+	if (!FileName.FindLastChar(TEXT('.'), DotIndex))
+	{
+		return false;
+	}
+
+	const FStringView Extension = FStringView(FileName).RightChop(DotIndex + 1);
+	for (const FString& Filter : Extensions)
+	{
+		if (Extension.Equals(Filter, ESearchCase::IgnoreCase))
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+TSharedPtr<const FUEMeshDirectoryScanner::FDirectoryListing> FUEMeshDirectoryScanner::ListDirectory(const FString& Directory, bool bUseCache)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UEMeshBPExport_ListDirectory);
+
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+	const FFileStatData DirectoryStat = PlatformFile.GetStatData(*Directory);
+	if (!DirectoryStat.bIsValid || !DirectoryStat.bIsDirectory)
+	{
+		return nullptr;
+	}
+
+	if (bUseCache)
+	{
+		FScopeLock Lock(&CacheLock);
+		const TSharedPtr<const FDirectoryListing>* CachedListing = Cache.Find(Directory);
+		if (CachedListing && (*CachedListing)->ModificationTime == DirectoryStat.ModificationTime)
+		{
+			return *CachedListing;
+		}
+	}
+
+	TSharedPtr<FDirectoryListing> Listing = MakeShared<FDirectoryListing>();
+	Listing->ModificationTime = DirectoryStat.ModificationTime;
+
+	PlatformFile.IterateDirectoryStat(*Directory, [&Listing](const TCHAR* FilenameOrDirectory, const FFileStatData& StatData)
+	{
+		if (StatData.bIsDirectory)
+		{
+			Listing->SubDirectories.Add(FilenameOrDirectory);
+		}
+		else
+		{
+			FFileEntry& Entry = Listing->Files.AddDefaulted_GetRef();
+			Entry.Name = FPaths::GetCleanFilename(FilenameOrDirectory);
+			Entry.Size = StatData.FileSize;
+			Entry.ModificationTime = StatData.ModificationTime;
+		}
+		return true;
+	});
+
+	{
+		FScopeLock Lock(&CacheLock);
+		Cache.Add(Directory, Listing);
+	}
+
+	return Listing;
+}
+
+void FUEMeshDirectoryScanner::Scan(const FString& Directory, const TArray<FString>& Extensions, bool bRecursive, bool bUseCache, TArray<FUEMeshFileInfo>& OutFiles)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UEMeshBPExport_ScanDirectory);
+
+	TArray<FString> NormalizedExtensions;
+	for (const FString& Filter : Extensions)
+	{
+		const FString Extension = NormalizeExtensionFilter(Filter);
+		if (Extension.IsEmpty())
+		{
+			// A match-all filter makes every other filter redundant
+			NormalizedExtensions.Reset();
+			break;
+		}
+		NormalizedExtensions.AddUnique(Extension);
+	}
+
+	FString RootDirectory = Directory;
+	FPaths::NormalizeDirectoryName(RootDirectory);
+
+	// Breadth-first, every directory of a level is listed in parallel. The network round trips of a
+	// remote tree overlap this way, while the output order stays the same from run to run.
+	TArray<FString> Level;
+	Level.Add(RootDirectory);
+	while (Level.Num() > 0)
+	{
+		TArray<TSharedPtr<const FDirectoryListing>> Listings;
+		Listings.SetNum(Level.Num());
+		ParallelFor(Level.Num(), [&Level, &Listings, bUseCache](int32 Index)
+		{
+			Listings[Index] = ListDirectory(Level[Index], bUseCache);
+		});
+
+		TArray<FString> NextLevel;
+		for (int32 Index = 0; Index < Level.Num(); Index++)
+		{
+			const FDirectoryListing* Listing = Listings[Index].Get();
+			if (!Listing)
+			{
+				continue;
+			}
+
+			// Full paths are only built for the files that pass the filter
+			for (const FFileEntry& Entry : Listing->Files)
+			{
+				if (MatchesExtension(Entry.Name, NormalizedExtensions))
+				{
+					FUEMeshFileInfo& FileInfo = OutFiles.AddDefaulted_GetRef();
+					FileInfo.Path = Level[Index] / Entry.Name;
+					FileInfo.Size = Entry.Size;
+					FileInfo.ModificationTime = Entry.ModificationTime;
+				}
+			}
+
+			if (bRecursive)
+			{
+				NextLevel.Append(Listing->SubDirectories);
+			}
+		}
+		Level = MoveTemp(NextLevel);
+	}
+}
+
+void FUEMeshDirectoryScanner::ClearCache()
+{
+	FScopeLock Lock(&CacheLock);
+	Cache.Empty();
+}
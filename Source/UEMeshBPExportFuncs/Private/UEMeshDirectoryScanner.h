@@ -0,0 +1,50 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UEMeshBPExportFuncsTypes.h"
+
+/*
+*	Directory walker behind ListFilesEx.
+*	Each level of the tree is listed in parallel with one IterateDirectoryStat call per directory, which returns the
+*	size and time of every entry without a separate stat per file. Listings are cached per directory for the lifetime of
+*	the editor and reused while the modification time of the directory is unchanged, so an unchanged tree costs one
+*	stat per directory.
+*
+*	The directory time only changes when entries are added, removed or renamed. A file rewritten in place keeps the size
+*	and time of the scan that cached its directory, pass bUseCache = false where those have to be exact.
+*/
+class FUEMeshDirectoryScanner
+{
+public:
+	/**
+	*	Lists the files below Directory whose extension is one of Extensions (without dot, case-insensitive).
+	*	An empty list or "*" matches every file. Files are returned directory by directory, breadth-first.
+	*/
+	static void Scan(const FString& Directory, const TArray<FString>& Extensions, bool bRecursive, bool bUseCache, TArray<FUEMeshFileInfo>& OutFiles);
+
+	/** Drops every cached listing */
+	static void ClearCache();
+
+private:
+	struct FFileEntry
+	{
+		FString Name;
+		int64 Size = 0;
+		FDateTime ModificationTime;
+	};
+
+	struct FDirectoryListing
+	{
+		FDateTime ModificationTime;
+		TArray<FFileEntry> Files;
+		TArray<FString> SubDirectories;
+	};
+
+	/** Listing of one directory, from the cache if the directory is unchanged. Null if the directory does not exist. */
+	static TSharedPtr<const FDirectoryListing> ListDirectory(const FString& Directory, bool bUseCache);
+
+	static FCriticalSection CacheLock;
+	static TMap<FString, TSharedPtr<const FDirectoryListing>> Cache;
+};
@@ -0,0 +1,250 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "UEMeshExportAsyncAction.h"
+#include "UEMeshBPExportFuncs.h"
+#include "UEMeshExportSession.h"
+
+#if WITH_EDITOR
+#include "GameFramework/Actor.h"
+#include "Engine/StreamableRenderAsset.h"
+#include "Materials/MaterialInterface.h"
+#include "Animation/AnimSequence.h"
+#include "HAL/PlatformTime.h"
+#endif
+
+UUEMeshExportAsyncAction* UUEMeshExportAsyncAction::ExportSkelMeshesAsync(const TArray<AActor*>& Actors, const FString& ExportPath, const FUEMeshExportOptions& Options, float TimeSliceMs)
+{
+	UUEMeshExportAsyncAction* Action = NewObject<UUEMeshExportAsyncAction>();
+	for (AActor* Actor : Actors)
+	{
+		Action->Actors.Add(Actor);
+	}
+	Action->ExportPath = ExportPath;
+	Action->Options = Options;
+	Action->TimeSliceSeconds = FMath::Max(TimeSliceMs, 1.0f) / 1000.0;
+	return Action;
+}
+
+void UUEMeshExportAsyncAction::Activate()
+{
+#if WITH_EDITOR
+	if (ExportPath.IsEmpty())
+	{
+		UE_LOG(LogUEMeshBPExport, Error, TEXT("ExportSkelMeshesAsync: ExportPath is empty"));
+		OnCompleted.Broadcast(0.0f, false, FUEMeshExportStats());
+		SetReadyToDestroy();
+		return;
+	}
+
+	Session = MakeShared<FUEMeshExportSession>(ExportPath, Options);
+	if (!Session->Initialize())
+	{
+		Session.Reset();
+		OnCompleted.Broadcast(0.0f, false, FUEMeshExportStats());
+		SetReadyToDestroy();
+		return;
+	}
+
+	// Each actor starts with a single item, its meshes and materials are queued once they are known
+	for (int32 ActorIndex = 0; ActorIndex < Actors.Num(); ActorIndex++)
+	{
+		WorkItems.Add({ EWorkItemType::CollectActor, ActorIndex });
+	}
+
+	// Sequences no actor plays come last, those the actors play are exported with their manifest
+	if (Options.bExportAnimations)
+	{
+		for (UAnimSequence* Animation : Options.Animations)
+		{
+			if (Animation)
+			{
+				WorkItems.Add({ EWorkItemType::ExportAnimation, INDEX_NONE, Animation });
+				ReferencedAssets.Add(Animation);
+			}
+		}
+	}
+
+	// Editor utility actions have no game instance to register with, stay rooted until the export is finished
+	AddToRoot();
+	bRunning = true;
+	TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateUObject(this, &UUEMeshExportAsyncAction::Tick));
+#else
+	UE_LOG(LogUEMeshBPExport, Error, TEXT("ExportSkelMeshesAsync: This function is only available in Editor"));
+	OnCompleted.Broadcast(0.0f, false, FUEMeshExportStats());
+	SetReadyToDestroy();
+#endif
+}
+
+void UUEMeshExportAsyncAction::Cancel()
+{
+	if (bRunning)
+	{
+		// Picked up by the next tick, the session has to wait for its texture writes before it can be closed
+		bCancelRequested = true;
+		return;
+	}
+
+	Super::Cancel();
+}
+
+bool UUEMeshExportAsyncAction::IsActive() const
+{
+	return bRunning;
+}
+
+bool UUEMeshExportAsyncAction::Tick(float DeltaTime)
+{
+#if WITH_EDITOR
+	TRACE_CPUPROFILER_EVENT_SCOPE(UEMeshBPExport_AsyncExportTick);
+
+	if (bCancelRequested)
+	{
+		FinishExport(true);
+		return false;
+	}
+
+	Session->PollTextureWrites();
+
+	// At least one item per frame, a single mesh export may take longer than the whole slice
+	const double SliceEndTime = FPlatformTime::Seconds() + TimeSliceSeconds;
+	do
+	{
+		if (NextWorkItem >= WorkItems.Num())
+		{
+			FinishExport(false);
+			return false;
+		}
+
+		// Copied since processing may queue further items
+		const FWorkItem WorkItem = WorkItems[NextWorkItem];
+		if (!ProcessWorkItem(WorkItem))
+		{
+			break;
+		}
+		NextWorkItem++;
+	}
+	while (FPlatformTime::Seconds() < SliceEndTime && !bCancelRequested);
+
+	Progress = FMath::Max(Progress, float(NextWorkItem) / float(WorkItems.Num()));
+	OnProgress.Broadcast(Progress, bAllSucceeded, Session->GetStats());
+	return true;
+#else
+	return false;
+#endif
+}
+
+bool UUEMeshExportAsyncAction::ProcessWorkItem(const FWorkItem& WorkItem)
+{
+#if WITH_EDITOR
+	switch (WorkItem.Type)
+	{
+	case EWorkItemType::CollectActor:
+	{
+		AActor* Actor = Actors[WorkItem.ActorIndex].Get();
+		TArray<UStreamableRenderAsset*> Meshes;
+		if (!Actor)
+		{
+			UE_LOG(LogUEMeshBPExport, Warning, TEXT("ExportSkelMeshesAsync: Skipping null or deleted actor"));
+			bAllSucceeded = false;
+			return true;
+		}
+		if (!Session->CollectActorMeshes(Actor, Meshes))
+		{
+			bAllSucceeded = false;
+			return true;
+		}
+
+		TArray<FWorkItem> ActorItems;
+		for (UStreamableRenderAsset* Mesh : Meshes)
+		{
+			ActorItems.Add({ EWorkItemType::ExportMesh, WorkItem.ActorIndex, Mesh });
+			ReferencedAssets.Add(Mesh);
+		}
+		ActorItems.Add({ EWorkItemType::WriteManifest, WorkItem.ActorIndex });
+		WorkItems.Insert(ActorItems, NextWorkItem + 1);
+		return true;
+	}
+	case EWorkItemType::ExportMesh:
+	{
+		UStreamableRenderAsset* Mesh = CastChecked<UStreamableRenderAsset>(WorkItem.Asset);
+		TArray<UMaterialInterface*> Materials;
+		if (!Session->ExportMeshFile(Mesh, Materials))
+		{
+			return true;
+		}
+
+		TArray<FWorkItem> MeshItems;
+		for (UMaterialInterface* Material : Materials)
+		{
+			MeshItems.Add({ EWorkItemType::ExportMaterial, WorkItem.ActorIndex, Material });
+			ReferencedAssets.Add(Material);
+		}
+		MeshItems.Add({ EWorkItemType::FinishMesh, WorkItem.ActorIndex, Mesh });
+		WorkItems.Insert(MeshItems, NextWorkItem + 1);
+		return true;
+	}
+	case EWorkItemType::ExportMaterial:
+	{
+		// A full texture queue defers the material to a later frame, the tick polls the queue before retrying it
+		bool bDeferred = false;
+		Session->ExportMaterial(CastChecked<UMaterialInterface>(WorkItem.Asset), &bDeferred);
+		return !bDeferred;
+	}
+	case EWorkItemType::FinishMesh:
+		Session->FinishMesh(CastChecked<UStreamableRenderAsset>(WorkItem.Asset));
+		return true;
+	case EWorkItemType::WriteManifest:
+	{
+		// Wait for the textures on later frames instead of blocking in WriteActorManifest
+		if (Session->PollTextureWrites() > 0)
+		{
+			return false;
+		}
+
+		AActor* Actor = Actors[WorkItem.ActorIndex].Get();
+		if (!Actor || !Session->WriteActorManifest(Actor, Actor->GetName()))
+		{
+			bAllSucceeded = false;
+		}
+		return true;
+	}
+	case EWorkItemType::ExportAnimation:
+		if (!Session->ExportAnimation(CastChecked<UAnimSequence>(WorkItem.Asset)))
+		{
+			bAllSucceeded = false;
+		}
+		return true;
+	}
+#endif
+	return true;
+}
+
+void UUEMeshExportAsyncAction::FinishExport(bool bCancelled)
+{
+#if WITH_EDITOR
+	FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+	TickerHandle.Reset();
+
+	Session->Finish();
+	const FUEMeshExportStats Stats = Session->GetStats();
+	Session.Reset();
+
+	WorkItems.Empty();
+	ReferencedAssets.Empty();
+	bRunning = false;
+
+	if (bCancelled)
+	{
+		UE_LOG(LogUEMeshBPExport, Log, TEXT("ExportSkelMeshesAsync: Cancelled at %.0f%%"), Progress * 100.0f);
+		OnCancelled.Broadcast(Progress, false, Stats);
+	}
+	else
+	{
+		Progress = 1.0f;
+		OnCompleted.Broadcast(Progress, bAllSucceeded, Stats);
+	}
+
+	RemoveFromRoot();
+	SetReadyToDestroy();
+#endif
+}
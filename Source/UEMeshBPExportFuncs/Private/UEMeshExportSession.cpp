@@ -0,0 +1,1659 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "UEMeshExportSession.h"
+#include "UEMeshBPExportFuncs.h"
+#include "UEMeshBPExportFuncsStats.h"
+
+#if WITH_EDITOR
+#include "AssetExportTask.h"
+#include "Exporters/Exporter.h"
+#include "GameFramework/Actor.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "Animation/AnimSequence.h"
+#include "Animation/AnimSingleNodeInstance.h"
+#include "Animation/Skeleton.h"
+#include "Engine/SkeletalMesh.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/SkinnedAssetCommon.h"
+#include "StaticMeshResources.h"
+#include "Rendering/SkeletalMeshRenderData.h"
+#include "Rendering/SkeletalMeshLODRenderData.h"
+#include "Components/InstancedStaticMeshComponent.h"
+#include "Materials/MaterialInterface.h"
+#include "Engine/Texture.h"
+#include "Engine/Texture2D.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "HAL/PlatformFileManager.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformTime.h"
+#include "UEMeshJsonFileWriter.h"
+#include "UEMeshGlbWriter.h"
+#include "UEMeshTextureWriter.h"
+#include "UEMeshAnimationWriter.h"
+#include "Exporters/FbxExportOption.h"
+#include "IImageWrapper.h"
+#include "IImageWrapperModule.h"
+#include "Async/Async.h"
+#include "Modules/ModuleManager.h"
+#include "Misc/SecureHash.h"
+#include "Misc/Crc.h"
+#include "Hash/CityHash.h"
+
+// Helper function: Get relative path from /Game
+static FString GetRelativePathFromGame(const FString& AssetPath)
+{
+	FString RelativePath = AssetPath;
+
+	// Remove package name suffix (e.g., "/Game/MyAsset.MyAsset" -> "/Game/MyAsset")
+	int32 DotIndex;
+	if (RelativePath.FindLastChar('.', DotIndex))
+	{
+		RelativePath = RelativePath.Left(DotIndex);
+	}
+
+	// Remove /Game prefix
+	if (RelativePath.StartsWith(TEXT("/Game/")))
+	{
+		RelativePath = RelativePath.RightChop(6); // Remove "/Game/"
+	}
+
+	return RelativePath;
+}
+
+// Helper function: Export texture with the exporter registered for the extension of OutputPath
+static bool ExportTextureWithExporter(UTexture2D* Texture, const FString& OutputPath)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UEMeshBPExport_ExportTextureWithExporter);
+
+	if (!Texture || OutputPath.IsEmpty())
+	{
+		return false;
+	}
+
+	// Export using UAssetExportTask
+	UAssetExportTask* ExportTask = NewObject<UAssetExportTask>();
+	ExportTask->Object = Texture;
+	ExportTask->Exporter = nullptr;
+	ExportTask->Filename = OutputPath;
+	ExportTask->bSelected = false;
+	ExportTask->bReplaceIdentical = true;
+	ExportTask->bPrompt = false;
+	ExportTask->bUseFileArchive = false;
+	ExportTask->bWriteEmptyFiles = false;
+
+	bool bSuccess = UExporter::RunAssetExportTask(ExportTask);
+
+	if (bSuccess && ExportTask->Errors.Num() == 0)
+	{
+		UE_LOG(LogUEMeshBPExport, Log, TEXT("Exported texture to: %s"), *OutputPath);
+		return true;
+	}
+	else
+	{
+		UE_LOG(LogUEMeshBPExport, Error, TEXT("Failed to export texture: %s"), *Texture->GetName());
+		return false;
+	}
+}
+
+// Helper function: Path of the exported texture file relative to the export root
+static FString GetTextureExportRelativePath(const UTexture2D* Texture, EUEMeshTextureFormat Format)
+{
+	return GetRelativePathFromGame(Texture->GetPathName()) + TEXT(".") + GetTextureFormatExtension(Format);
+}
+
+// Helper function: Collect the 2D textures bound to the texture parameters of a material
+static void GetMaterialTextureParameters(UMaterialInterface* Material, TArray<TPair<FMaterialParameterInfo, UTexture2D*>>& OutTextureParameters)
+{
+	TArray<FMaterialParameterInfo> TextureParameterInfos;
+	TArray<FGuid> TextureParameterIds;
+	Material->GetAllTextureParameterInfo(TextureParameterInfos, TextureParameterIds);
+
+	for (const FMaterialParameterInfo& ParamInfo : TextureParameterInfos)
+	{
+		UTexture* ParamTexture = nullptr;
+		if (Material->GetTextureParameterValue(ParamInfo, ParamTexture) && ParamTexture)
+		{
+			if (UTexture2D* Texture2D = Cast<UTexture2D>(ParamTexture))
+			{
+				OutTextureParameters.Emplace(ParamInfo, Texture2D);
+			}
+		}
+	}
+}
+
+// Helper function: Read the scalar, vector and texture parameter values of a material, textures have to be exported already
+static void CollectMaterialParameters(UMaterialInterface* Material, const TArray<TPair<FMaterialParameterInfo, UTexture2D*>>& TextureParameters, const TMap<UTexture*, FString>& TextureOutputPaths, FUEMeshBinaryManifest::FMaterial& OutMaterial)
+{
+	OutMaterial.Name = Material->GetName();
+	OutMaterial.AssetPath = Material->GetPathName();
+
+	// Collect scalar parameters
+	TArray<FMaterialParameterInfo> ScalarParameterInfos;
+	TArray<FGuid> ScalarParameterIds;
+	Material->GetAllScalarParameterInfo(ScalarParameterInfos, ScalarParameterIds);
+
+	for (const FMaterialParameterInfo& ParamInfo : ScalarParameterInfos)
+	{
+		float ParamValue = 0.0f;
+		if (Material->GetScalarParameterValue(ParamInfo, ParamValue))
+		{
+			OutMaterial.ScalarParameters.Emplace(ParamInfo.Name.ToString(), ParamValue);
+		}
+	}
+
+	// Collect vector parameters
+	TArray<FMaterialParameterInfo> VectorParameterInfos;
+	TArray<FGuid> VectorParameterIds;
+	Material->GetAllVectorParameterInfo(VectorParameterInfos, VectorParameterIds);
+
+	for (const FMaterialParameterInfo& ParamInfo : VectorParameterInfos)
+	{
+		FLinearColor ParamValue;
+		if (Material->GetVectorParameterValue(ParamInfo, ParamValue))
+		{
+			OutMaterial.VectorParameters.Emplace(ParamInfo.Name.ToString(), ParamValue);
+		}
+	}
+
+	// Collect texture parameters
+	for (const TPair<FMaterialParameterInfo, UTexture2D*>& TextureParameter : TextureParameters)
+	{
+		FUEMeshBinaryManifest::FTextureParameter& Parameter = OutMaterial.TextureParameters.AddDefaulted_GetRef();
+		Parameter.ParameterName = TextureParameter.Key.Name.ToString();
+		Parameter.TextureAssetPath = TextureParameter.Value->GetPathName();
+		Parameter.ExportedPath = TextureOutputPaths.FindRef(TextureParameter.Value);
+	}
+}
+
+// Helper function: Export a skeletal or static mesh to FBX, with all LODs as an LOD group if asked to
+static bool ExportMeshToFBX(UStreamableRenderAsset* Mesh, const FString& OutputPath, bool bLevelsOfDetail, bool bMorphTargets)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UEMeshBPExport_ExportMeshToFBX);
+
+	if (!Mesh || OutputPath.IsEmpty())
+	{
+		return false;
+	}
+
+	// Export using UAssetExportTask
+	UAssetExportTask* ExportTask = NewObject<UAssetExportTask>();
+	ExportTask->Object = Mesh;
+	ExportTask->Exporter = nullptr;
+	ExportTask->Filename = OutputPath;
+	ExportTask->bSelected = false;
+	ExportTask->bReplaceIdentical = true;
+	ExportTask->bPrompt = false;
+	ExportTask->bUseFileArchive = false;
+	ExportTask->bWriteEmptyFiles = false;
+	ExportTask->bAutomated = true;
+
+	UFbxExportOption* FbxOptions = NewObject<UFbxExportOption>();
+	FbxOptions->bExportMorphTargets = bMorphTargets;
+	FbxOptions->bExportPreviewMesh = false;
+	FbxOptions->bExportLocalTime = false;
+	FbxOptions->bForceFrontXAxis = false;
+	FbxOptions->Collision = false;
+	FbxOptions->LevelOfDetail = bLevelsOfDetail;
+
+	ExportTask->Options = FbxOptions;
+
+	bool bSuccess = UExporter::RunAssetExportTask(ExportTask);
+
+	if (bSuccess && ExportTask->Errors.Num() == 0)
+	{
+		UE_LOG(LogUEMeshBPExport, Log, TEXT("Exported mesh to: %s"), *OutputPath);
+		return true;
+	}
+	else
+	{
+		UE_LOG(LogUEMeshBPExport, Error, TEXT("Failed to export mesh: %s"), *Mesh->GetName());
+		return false;
+	}
+}
+
+// Helper function: Number of LODs in the render data of a skeletal or static mesh
+static int32 GetMeshNumLODs(UStreamableRenderAsset* Mesh)
+{
+	if (USkeletalMesh* SkeletalMesh = Cast<USkeletalMesh>(Mesh))
+	{
+		const FSkeletalMeshRenderData* RenderData = SkeletalMesh->GetResourceForRendering();
+		return RenderData ? RenderData->LODRenderData.Num() : 0;
+	}
+	if (UStaticMesh* StaticMesh = Cast<UStaticMesh>(Mesh))
+	{
+		const FStaticMeshRenderData* RenderData = StaticMesh->GetRenderData();
+		return RenderData ? RenderData->LODResources.Num() : 0;
+	}
+	return 0;
+}
+
+// Helper function: Screen size and render vertex and triangle counts of one LOD
+static void GetMeshLODInfo(UStreamableRenderAsset* Mesh, int32 LODIndex, float& OutScreenSize, int32& OutNumVertices, int32& OutNumTriangles)
+{
+	OutScreenSize = 0.0f;
+	OutNumVertices = 0;
+	OutNumTriangles = 0;
+
+	if (USkeletalMesh* SkeletalMesh = Cast<USkeletalMesh>(Mesh))
+	{
+		if (const FSkeletalMeshLODInfo* LODInfo = SkeletalMesh->GetLODInfo(LODIndex))
+		{
+			OutScreenSize = LODInfo->ScreenSize.Default;
+		}
+		const FSkeletalMeshRenderData* RenderData = SkeletalMesh->GetResourceForRendering();
+		if (RenderData && RenderData->LODRenderData.IsValidIndex(LODIndex))
+		{
+			OutNumVertices = RenderData->LODRenderData[LODIndex].GetNumVertices();
+			OutNumTriangles = RenderData->LODRenderData[LODIndex].GetTotalFaces();
+		}
+	}
+	else if (UStaticMesh* StaticMesh = Cast<UStaticMesh>(Mesh))
+	{
+		const FStaticMeshRenderData* RenderData = StaticMesh->GetRenderData();
+		if (RenderData && RenderData->LODResources.IsValidIndex(LODIndex))
+		{
+			OutScreenSize = RenderData->ScreenSize[LODIndex].Default;
+			OutNumVertices = RenderData->LODResources[LODIndex].GetNumVertices();
+			OutNumTriangles = RenderData->LODResources[LODIndex].GetNumTriangles();
+		}
+	}
+}
+
+FUEMeshExportSession::FUEMeshExportSession(const FString& InExportPath, const FUEMeshExportOptions& InOptions)
+	: ExportPath(InExportPath)
+	, Options(InOptions)
+	, StartTime(FPlatformTime::Seconds())
+{
+}
+
+bool FUEMeshExportSession::Initialize()
+{
+	// Ensure export directory exists
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+	if (!PlatformFile.DirectoryExists(*ExportPath))
+	{
+		if (!PlatformFile.CreateDirectoryTree(*ExportPath))
+		{
+			UE_LOG(LogUEMeshBPExport, Error, TEXT("ExportSkelMeshes: Failed to create directory: %s"), *ExportPath);
+			return false;
+		}
+	}
+	KnownDirectories.Add(ExportPath);
+
+	StateCache.Load(ExportPath);
+
+	// Actors and materials skipped or not exported by this session keep their records from the last export
+	if (Options.bWriteBinaryManifest)
+	{
+		BinaryManifest.Load(FPaths::Combine(ExportPath, FUEMeshBinaryManifest::FileName));
+	}
+
+	return true;
+}
+
+void FUEMeshExportSession::Finish()
+{
+	FlushTextureWrites();
+	if (ProcessedAnimations.Num() > 0)
+	{
+		WriteAnimationIndex();
+	}
+	if (StateChangesFile.IsEmpty())
+	{
+		StateCache.Save();
+	}
+	else
+	{
+		StateCache.SaveChanges(StateChangesFile);
+	}
+
+	if (Options.bWriteBinaryManifest)
+	{
+		const double ManifestStartTime = FPlatformTime::Seconds();
+		const FString BinaryManifestPath = FPaths::Combine(ExportPath, FUEMeshBinaryManifest::FileName);
+		if (BinaryManifest.Save(BinaryManifestPath))
+		{
+			AddBytesWritten(BinaryManifestPath);
+			UE_LOG(LogUEMeshBPExport, Log, TEXT("ExportSkelMeshes: Wrote binary manifest: %s"), *BinaryManifestPath);
+		}
+		else
+		{
+			UE_LOG(LogUEMeshBPExport, Error, TEXT("ExportSkelMeshes: Failed to write binary manifest: %s"), *BinaryManifestPath);
+		}
+		Stats.ManifestWriteSeconds += FPlatformTime::Seconds() - ManifestStartTime;
+	}
+
+	Stats.TotalSeconds = FPlatformTime::Seconds() - StartTime;
+
+	UE_LOG(LogUEMeshBPExport, Log, TEXT("ExportSkelMeshes: Session finished in %.2fs. %d actors, %d meshes, %d materials, %d textures (reused %d/%d/%d, %d deduplicated)"),
+		Stats.TotalSeconds, Stats.NumActors, Stats.NumMeshes, Stats.NumMaterials, Stats.NumTextures,
+		Stats.NumMeshesReused, Stats.NumMaterialsReused, Stats.NumTexturesReused, Stats.NumTexturesDeduplicated);
+	UE_LOG(LogUEMeshBPExport, Log, TEXT("ExportSkelMeshes: Export cache %d hits, %d misses. %.2f MB written"),
+		Stats.NumUpToDate, Stats.NumCacheMisses, Stats.BytesWritten / (1024.0 * 1024.0));
+	UE_LOG(LogUEMeshBPExport, Log, TEXT("ExportSkelMeshes: Mesh %.2fs, Material %.2fs, Texture %.2fs, Animation %.2fs, Manifest %.2fs"),
+		Stats.MeshExportSeconds, Stats.MaterialExportSeconds, Stats.TextureExportSeconds, Stats.AnimationExportSeconds, Stats.ManifestWriteSeconds);
+	if (Stats.NumAnimations > 0 || Stats.NumSkeletons > 0)
+	{
+		UE_LOG(LogUEMeshBPExport, Log, TEXT("ExportSkelMeshes: %d animations, %d skeletons"), Stats.NumAnimations, Stats.NumSkeletons);
+	}
+}
+
+uint32 FUEMeshExportSession::GetOptionsHash(const TCHAR* OutputKind) const
+{
+	// Bump the version whenever the content written for an output kind changes
+	static const int32 ExportFormatVersion = 1;
+	FString OptionsString = FString::Printf(TEXT("%s;v%d"), OutputKind, ExportFormatVersion);
+
+	// Only options that change the written bytes of this kind, toggling the others must not invalidate it
+	if (FCString::Strcmp(OutputKind, TEXT("material")) == 0)
+	{
+		OptionsString += FString::Printf(TEXT(";compact%d"), Options.bCompactJson ? 1 : 0);
+	}
+	else if (FCString::Strcmp(OutputKind, TEXT("texture")) == 0)
+	{
+		OptionsString += FString::Printf(TEXT(";%s;mip%d;max%d"), GetTextureFormatExtension(Options.TextureFormat), Options.TextureMipLevel, Options.MaxTextureSize);
+		if (Options.TextureFormat == EUEMeshTextureFormat::PNG)
+		{
+			OptionsString += FString::Printf(TEXT(";level%d"), Options.PngCompressionLevel);
+		}
+	}
+	else if (FCString::Strcmp(OutputKind, TEXT("fbx")) == 0)
+	{
+		OptionsString += FString::Printf(TEXT(";lods%d;morphs%d"), Options.bExportLODs ? 1 : 0, Options.bExportMorphTargets ? 1 : 0);
+	}
+	else if (FCString::Strcmp(OutputKind, TEXT("glb")) == 0)
+	{
+		// LODs go to files of their own, only morph targets change the bytes of a GLB
+		OptionsString += FString::Printf(TEXT(";morphs%d"), Options.bExportMorphTargets ? 1 : 0);
+	}
+	else if (FCString::Strcmp(OutputKind, TEXT("animation")) == 0)
+	{
+		OptionsString += FString::Printf(TEXT(";tolerance%g;quantize%d"), Options.AnimationKeyTolerance, Options.bQuantizeAnimations ? 1 : 0);
+	}
+	else if (FCString::Strcmp(OutputKind, TEXT("skeleton")) == 0)
+	{
+		OptionsString += FString::Printf(TEXT(";compact%d"), Options.bCompactJson ? 1 : 0);
+	}
+
+	return FCrc::StrCrc32(*OptionsString);
+}
+
+void FUEMeshExportSession::EnsureDirectory(const FString& Directory)
+{
+	if (KnownDirectories.Contains(Directory))
+	{
+		return;
+	}
+
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+	if (!PlatformFile.DirectoryExists(*Directory))
+	{
+		PlatformFile.CreateDirectoryTree(*Directory);
+	}
+	KnownDirectories.Add(Directory);
+}
+
+bool FUEMeshExportSession::CheckUpToDate(const FString& AssetKey, const FString& SourceHash, uint32 OptionsHash, const FString& RelativeOutputPath)
+{
+	if (StateCache.IsUpToDate(AssetKey, SourceHash, OptionsHash, RelativeOutputPath))
+	{
+		Stats.NumUpToDate++;
+		INC_DWORD_STAT(STAT_UEMeshBPExport_CacheHits);
+		return true;
+	}
+
+	Stats.NumCacheMisses++;
+	INC_DWORD_STAT(STAT_UEMeshBPExport_CacheMisses);
+	return false;
+}
+
+void FUEMeshExportSession::AddBytesWritten(const FString& FilePath)
+{
+	const int64 FileSize = IFileManager::Get().FileSize(*FilePath);
+	if (FileSize > 0)
+	{
+		Stats.BytesWritten += FileSize;
+		INC_MEMORY_STAT_BY(STAT_UEMeshBPExport_BytesWritten, FileSize);
+	}
+}
+
+// Helper function: Key of the image a texture export writes, equal for textures with the same source content.
+// Imported textures use the hash of their source payload as source id, so no pixel has to be read for the key.
+static uint64 GetTextureContentKey(const UTexture2D* Texture, int32 TargetSizeX, int32 TargetSizeY)
+{
+	const FGuid SourceId = Texture->Source.GetId();
+	const uint32 Layout[] = { SourceId.A, SourceId.B, SourceId.C, SourceId.D, (uint32)Texture->Source.GetFormat(), (uint32)Texture->SRGB, (uint32)TargetSizeX, (uint32)TargetSizeY };
+	return CityHash64(reinterpret_cast<const char*>(Layout), sizeof(Layout));
+}
+
+bool FUEMeshExportSession::IsSharedTextureUpToDate(const FString& OwnerKey, uint32 OptionsHash, const FString& RelativeOutputPath)
+{
+	// The owner may not be part of this export, it is loaded to see whether it changed since it wrote the file
+	const UTexture* Owner = LoadObject<UTexture>(nullptr, *OwnerKey, nullptr, LOAD_NoWarn | LOAD_Quiet);
+	return Owner && StateCache.IsUpToDate(OwnerKey, FUEMeshExportStateCache::ComputeSourceHash(Owner), OptionsHash, RelativeOutputPath);
+}
+
+bool FUEMeshExportSession::ExportTexture(UTexture2D* Texture, bool bWaitForQueue)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UEMeshBPExport_ExportTexture);
+
+	if (TextureOutputPaths.Contains(Texture))
+	{
+		Stats.NumTexturesReused++;
+		return true;
+	}
+
+	// Checked before anything is recorded, so the texture can simply be exported again once there is room
+	if (!bWaitForQueue && IsTextureQueueFull())
+	{
+		return false;
+	}
+
+	const double TextureStartTime = FPlatformTime::Seconds();
+
+	const FString AssetKey = Texture->GetPathName();
+	const FString SourceHash = FUEMeshExportStateCache::ComputeSourceHash(Texture);
+	const uint32 OptionsHash = GetOptionsHash(TEXT("texture"));
+	const FString RelativeOutputPath = GetTextureExportRelativePath(Texture, Options.TextureFormat);
+	const FString OutputPath = FPaths::Combine(ExportPath, RelativeOutputPath);
+
+	// A texture deduplicated by an earlier export references the file of the texture it matched. That file is only
+	// still its content while the owner is unchanged as well, otherwise the texture is exported again below.
+	FString RecordedOutputPath;
+	FString SharedFrom;
+	FString& ResolvedOutputPath = TextureOutputPaths.Add(Texture, RelativeOutputPath);
+	if (StateCache.FindOutput(AssetKey, RecordedOutputPath, SharedFrom) && !SharedFrom.IsEmpty()
+		&& IsSharedTextureUpToDate(SharedFrom, OptionsHash, RecordedOutputPath))
+	{
+		ResolvedOutputPath = RecordedOutputPath;
+	}
+
+	if (CheckUpToDate(AssetKey, SourceHash, OptionsHash, ResolvedOutputPath))
+	{
+		UE_LOG(LogUEMeshBPExport, Log, TEXT("Texture file is up to date, skipping: %s"), *FPaths::Combine(ExportPath, ResolvedOutputPath));
+	}
+	else
+	{
+		ResolvedOutputPath = RelativeOutputPath;
+
+		// Source data can only be read on the game thread, encoding and writing happen on the thread pool.
+		// The requested mip is decompressed on its own when the source stores it, otherwise the smallest stored mip
+		// is read and downscaled on the thread pool.
+		int32 TargetMip = 0;
+		int32 SourceMip = 0;
+		int32 TargetSizeX = 0;
+		int32 TargetSizeY = 0;
+		uint64 ContentKey = 0;
+		const FSharedTexture* SharedTexture = nullptr;
+		if (Texture->Source.IsValid())
+		{
+			TargetMip = GetTextureExportMip(Texture->Source.GetSizeX(), Texture->Source.GetSizeY(), Options);
+			SourceMip = FMath::Min(TargetMip, Texture->Source.GetNumMips() - 1);
+			TargetSizeX = FMath::Max(Texture->Source.GetSizeX() >> TargetMip, 1);
+			TargetSizeY = FMath::Max(Texture->Source.GetSizeY() >> TargetMip, 1);
+
+			// Identical payloads under different asset paths are encoded once, the others reference that file
+			ContentKey = GetTextureContentKey(Texture, TargetSizeX, TargetSizeY);
+			SharedTexture = TexturesByContent.Find(ContentKey);
+		}
+
+		// The mip is only read for a texture that actually writes its file
+		FImage SourceImage;
+		if (SharedTexture)
+		{
+			UE_LOG(LogUEMeshBPExport, Log, TEXT("Texture %s has the same content as %s, sharing its file"), *AssetKey, *SharedTexture->OwnerKey);
+			ResolvedOutputPath = SharedTexture->RelativeOutputPath;
+			Stats.NumTexturesDeduplicated++;
+			RecordSharedTexture(AssetKey, SourceHash, OptionsHash, SharedTexture->OwnerKey);
+		}
+		else if (Texture->Source.IsValid() && Texture->Source.GetMipImage(SourceImage, 0, 0, SourceMip))
+		{
+			TexturesByContent.Add(ContentKey, { RelativeOutputPath, AssetKey });
+			EnsureDirectory(FPaths::GetPath(OutputPath));
+
+			FPendingTextureWrite PendingWrite;
+			PendingWrite.AssetKey = AssetKey;
+			PendingWrite.SourceHash = SourceHash;
+			PendingWrite.OptionsHash = OptionsHash;
+			PendingWrite.RelativeOutputPath = RelativeOutputPath;
+			QueueTextureWrite(MoveTemp(SourceImage), TargetSizeX, TargetSizeY, MoveTemp(PendingWrite));
+		}
+		else
+		{
+			EnsureDirectory(FPaths::GetPath(OutputPath));
+			if (ExportTextureWithExporter(Texture, OutputPath))
+			{
+				// Textures without editable source data go through the regular exporter, at full resolution
+				Stats.NumTextures++;
+				INC_DWORD_STAT(STAT_UEMeshBPExport_TexturesExported);
+				AddBytesWritten(OutputPath);
+				StateCache.Record(AssetKey, SourceHash, OptionsHash, RelativeOutputPath);
+			}
+			else
+			{
+				StateCache.Invalidate(AssetKey);
+			}
+		}
+	}
+
+	Stats.TextureExportSeconds += FPlatformTime::Seconds() - TextureStartTime;
+	return true;
+}
+
+void FUEMeshExportSession::RecordSharedTexture(const FString& AssetKey, const FString& SourceHash, uint32 OptionsHash, const FString& OwnerKey)
+{
+	// The owner's file may still be in flight, the duplicate is recorded once it has been written
+	for (FPendingTextureWrite& PendingWrite : PendingTextureWrites)
+	{
+		if (PendingWrite.AssetKey == OwnerKey)
+		{
+			PendingWrite.SharedBy.Emplace(AssetKey, SourceHash);
+			return;
+		}
+	}
+
+	StateCache.RecordShared(AssetKey, SourceHash, OptionsHash, OwnerKey);
+}
+
+bool FUEMeshExportSession::IsTextureQueueFull() const
+{
+	// Bounds the number of decoded source images held in memory at once
+	const int32 MaxPendingWrites = FMath::Max(2, FPlatformMisc::NumberOfWorkerThreadsToSpawn());
+	return PendingTextureWrites.Num() >= MaxPendingWrites;
+}
+
+void FUEMeshExportSession::QueueTextureWrite(FImage&& SourceImage, int32 TargetSizeX, int32 TargetSizeY, FPendingTextureWrite&& PendingWrite)
+{
+	while (IsTextureQueueFull())
+	{
+		CompleteTextureWrite(PendingTextureWrites[0]);
+		PendingTextureWrites.RemoveAt(0);
+	}
+
+	IImageWrapperModule* ImageWrapperModule = &FModuleManager::LoadModuleChecked<IImageWrapperModule>(FName("ImageWrapper"));
+	const FString OutputPath = FPaths::Combine(ExportPath, PendingWrite.RelativeOutputPath);
+
+	// The future returns the MD5 of the written file, or an empty string on failure
+	PendingWrite.Result = Async(EAsyncExecution::ThreadPool, [ImageWrapperModule, Image = MoveTemp(SourceImage), TargetSizeX, TargetSizeY, Format = Options.TextureFormat, PngCompressionLevel = Options.PngCompressionLevel, OutputPath]() mutable -> FString
+	{
+		TArray64<uint8> CompressedData;
+		if (!EncodeTextureImage(*ImageWrapperModule, Image, TargetSizeX, TargetSizeY, Format, PngCompressionLevel, CompressedData)
+			|| !FFileHelper::SaveArrayToFile(CompressedData, *OutputPath))
+		{
+			return FString();
+		}
+
+		FMD5 Md5;
+		Md5.Update(CompressedData.GetData(), CompressedData.Num());
+		FMD5Hash OutputHash;
+		OutputHash.Set(Md5);
+		return LexToString(OutputHash);
+	});
+
+	PendingTextureWrites.Add(MoveTemp(PendingWrite));
+}
+
+void FUEMeshExportSession::CompleteTextureWrite(FPendingTextureWrite& PendingWrite)
+{
+	const FString OutputHash = PendingWrite.Result.Get();
+	if (!OutputHash.IsEmpty())
+	{
+		UE_LOG(LogUEMeshBPExport, Log, TEXT("Exported texture to: %s"), *FPaths::Combine(ExportPath, PendingWrite.RelativeOutputPath));
+		Stats.NumTextures++;
+		INC_DWORD_STAT(STAT_UEMeshBPExport_TexturesExported);
+		AddBytesWritten(FPaths::Combine(ExportPath, PendingWrite.RelativeOutputPath));
+		StateCache.Record(PendingWrite.AssetKey, PendingWrite.SourceHash, PendingWrite.OptionsHash, PendingWrite.RelativeOutputPath, OutputHash);
+	}
+	else
+	{
+		UE_LOG(LogUEMeshBPExport, Error, TEXT("Failed to export texture: %s"), *FPaths::Combine(ExportPath, PendingWrite.RelativeOutputPath));
+		StateCache.Invalidate(PendingWrite.AssetKey);
+	}
+
+	// Invalidated along with a failed owner
+	for (const TPair<FString, FString>& SharedBy : PendingWrite.SharedBy)
+	{
+		StateCache.RecordShared(SharedBy.Key, SharedBy.Value, PendingWrite.OptionsHash, PendingWrite.AssetKey);
+	}
+}
+
+void FUEMeshExportSession::FlushTextureWrites()
+{
+	if (PendingTextureWrites.Num() == 0)
+	{
+		return;
+	}
+
+	TRACE_CPUPROFILER_EVENT_SCOPE(UEMeshBPExport_FlushTextureWrites);
+	const double FlushStartTime = FPlatformTime::Seconds();
+
+	for (FPendingTextureWrite& PendingWrite : PendingTextureWrites)
+	{
+		CompleteTextureWrite(PendingWrite);
+	}
+	PendingTextureWrites.Reset();
+
+	Stats.TextureExportSeconds += FPlatformTime::Seconds() - FlushStartTime;
+}
+
+int32 FUEMeshExportSession::PollTextureWrites()
+{
+	const double PollStartTime = FPlatformTime::Seconds();
+
+	for (int32 Index = PendingTextureWrites.Num() - 1; Index >= 0; Index--)
+	{
+		if (PendingTextureWrites[Index].Result.IsReady())
+		{
+			CompleteTextureWrite(PendingTextureWrites[Index]);
+			PendingTextureWrites.RemoveAtSwap(Index);
+		}
+	}
+
+	Stats.TextureExportSeconds += FPlatformTime::Seconds() - PollStartTime;
+	return PendingTextureWrites.Num();
+}
+
+// Helper function: Collect and export material parameters
+FString FUEMeshExportSession::WriteMaterialJSON(UMaterialInterface* Material, bool* bOutDeferred)
+{
+	FString MaterialRelativePath = GetRelativePathFromGame(Material->GetPathName());
+	FString MaterialJsonPath = FPaths::Combine(ExportPath, MaterialRelativePath + TEXT("_material.json"));
+
+	TArray<TPair<FMaterialParameterInfo, UTexture2D*>> TextureParameters;
+	GetMaterialTextureParameters(Material, TextureParameters);
+
+	// Textures are tracked separately, they may have been reimported on their own. They are exported first because
+	// deduplication decides which file each of them references.
+	// An export deferred by a full texture queue continues after the textures it already exported.
+	FString TexturePaths;
+	int32 NumTexturesExported = 0;
+	DeferredMaterials.RemoveAndCopyValue(Material, NumTexturesExported);
+	for (int32 TextureIndex = 0; TextureIndex < TextureParameters.Num(); TextureIndex++)
+	{
+		UTexture2D* Texture = TextureParameters[TextureIndex].Value;
+		if (TextureIndex >= NumTexturesExported && !ExportTexture(Texture, bOutDeferred == nullptr))
+		{
+			DeferredMaterials.Add(Material, TextureIndex);
+			*bOutDeferred = true;
+			return FString();
+		}
+		TexturePaths += TextureOutputPaths.FindChecked(Texture) + TEXT(";");
+	}
+
+	// Skip the JSON if neither the material nor its parents changed since the last export, and its textures still
+	// reference the same files
+	const FString AssetKey = Material->GetPathName();
+	FString SourceHash = FUEMeshExportStateCache::ComputeSourceHash(Material);
+	if (!SourceHash.IsEmpty())
+	{
+		SourceHash += FString::Printf(TEXT("-%08x"), FCrc::StrCrc32(*TexturePaths));
+	}
+	const uint32 OptionsHash = GetOptionsHash(TEXT("material"));
+	if (CheckUpToDate(AssetKey, SourceHash, OptionsHash, MaterialRelativePath + TEXT("_material.json")))
+	{
+		// The binary manifest is rewritten as a whole, so it needs the parameters even when the JSON is skipped
+		if (Options.bWriteBinaryManifest)
+		{
+			FUEMeshBinaryManifest::FMaterial MaterialData;
+			CollectMaterialParameters(Material, TextureParameters, TextureOutputPaths, MaterialData);
+			BinaryManifest.Materials.Add(MaterialRelativePath + TEXT("_material.json"), MoveTemp(MaterialData));
+		}
+
+		return MaterialRelativePath + TEXT("_material.json");
+	}
+
+	// Ensure directory exists
+	EnsureDirectory(FPaths::GetPath(MaterialJsonPath));
+
+	FUEMeshBinaryManifest::FMaterial MaterialData;
+	CollectMaterialParameters(Material, TextureParameters, TextureOutputPaths, MaterialData);
+
+	// Parameters are streamed to the file, no JSON DOM is built
+	const bool bSaved = WriteJsonFile(MaterialJsonPath, Options.bCompactJson, [&MaterialData](auto& JsonWriter)
+	{
+		JsonWriter.WriteObjectStart();
+		JsonWriter.WriteValue(TEXT("MaterialName"), MaterialData.Name);
+		JsonWriter.WriteValue(TEXT("MaterialAssetPath"), MaterialData.AssetPath);
+
+		JsonWriter.WriteArrayStart(TEXT("ScalarParameters"));
+		for (const TPair<FString, float>& Parameter : MaterialData.ScalarParameters)
+		{
+			JsonWriter.WriteObjectStart();
+			JsonWriter.WriteValue(TEXT("Name"), Parameter.Key);
+			JsonWriter.WriteValue(TEXT("Value"), (double)Parameter.Value);
+			JsonWriter.WriteObjectEnd();
+		}
+		JsonWriter.WriteArrayEnd();
+
+		JsonWriter.WriteArrayStart(TEXT("VectorParameters"));
+		for (const TPair<FString, FLinearColor>& Parameter : MaterialData.VectorParameters)
+		{
+			JsonWriter.WriteObjectStart();
+			JsonWriter.WriteValue(TEXT("Name"), Parameter.Key);
+			JsonWriter.WriteObjectStart(TEXT("Value"));
+			JsonWriter.WriteValue(TEXT("R"), (double)Parameter.Value.R);
+			JsonWriter.WriteValue(TEXT("G"), (double)Parameter.Value.G);
+			JsonWriter.WriteValue(TEXT("B"), (double)Parameter.Value.B);
+			JsonWriter.WriteValue(TEXT("A"), (double)Parameter.Value.A);
+			JsonWriter.WriteObjectEnd();
+			JsonWriter.WriteObjectEnd();
+		}
+		JsonWriter.WriteArrayEnd();
+
+		JsonWriter.WriteArrayStart(TEXT("TextureParameters"));
+		for (const FUEMeshBinaryManifest::FTextureParameter& Parameter : MaterialData.TextureParameters)
+		{
+			JsonWriter.WriteObjectStart();
+			JsonWriter.WriteValue(TEXT("ParameterName"), Parameter.ParameterName);
+			JsonWriter.WriteValue(TEXT("TextureAssetPath"), Parameter.TextureAssetPath);
+			// Store relative path in JSON
+			JsonWriter.WriteValue(TEXT("ExportedTexturePath"), Parameter.ExportedPath);
+			if (Parameter.ExportedPath.EndsWith(TEXT(".png")))
+			{
+				JsonWriter.WriteValue(TEXT("ExportedPNGPath"), Parameter.ExportedPath);
+			}
+			JsonWriter.WriteObjectEnd();
+		}
+		JsonWriter.WriteArrayEnd();
+
+		JsonWriter.WriteObjectEnd();
+	});
+
+	if (bSaved)
+	{
+		UE_LOG(LogUEMeshBPExport, Log, TEXT("Exported material JSON to: %s"), *MaterialJsonPath);
+		Stats.NumMaterials++;
+		INC_DWORD_STAT(STAT_UEMeshBPExport_MaterialsExported);
+		AddBytesWritten(MaterialJsonPath);
+		StateCache.Record(AssetKey, SourceHash, OptionsHash, MaterialRelativePath + TEXT("_material.json"));
+		if (Options.bWriteBinaryManifest)
+		{
+			BinaryManifest.Materials.Add(MaterialRelativePath + TEXT("_material.json"), MoveTemp(MaterialData));
+		}
+		return MaterialRelativePath + TEXT("_material.json");
+	}
+	else
+	{
+		UE_LOG(LogUEMeshBPExport, Error, TEXT("Failed to export material JSON: %s"), *MaterialJsonPath);
+		StateCache.Invalidate(AssetKey);
+		return FString();
+	}
+}
+
+FString FUEMeshExportSession::ExportMaterialToJSON(UMaterialInterface* Material, bool* bOutDeferred)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UEMeshBPExport_ExportMaterialToJSON);
+
+	if (!Material)
+	{
+		return FString();
+	}
+
+	if (const FString* CachedPath = ProcessedMaterials.Find(Material))
+	{
+		Stats.NumMaterialsReused++;
+		return *CachedPath;
+	}
+
+	const double MaterialStartTime = FPlatformTime::Seconds();
+	const double TextureSecondsBefore = Stats.TextureExportSeconds;
+
+	bool bDeferred = false;
+	FString Result = WriteMaterialJSON(Material, bOutDeferred ? &bDeferred : nullptr);
+	if (bDeferred)
+	{
+		*bOutDeferred = true;
+	}
+	else
+	{
+		ProcessedMaterials.Add(Material, Result);
+	}
+
+	// Texture export runs inside the material loop, keep the two phases separate
+	const double TextureSeconds = Stats.TextureExportSeconds - TextureSecondsBefore;
+	Stats.MaterialExportSeconds += FPlatformTime::Seconds() - MaterialStartTime - TextureSeconds;
+
+	return Result;
+}
+
+// Helper function: Collect the material slots of a skeletal or static mesh
+static void GetMeshMaterialSlots(UStreamableRenderAsset* Mesh, TArray<TPair<FName, UMaterialInterface*>>& OutSlots)
+{
+	if (const USkeletalMesh* SkeletalMesh = Cast<USkeletalMesh>(Mesh))
+	{
+		for (const FSkeletalMaterial& SkeletalMaterial : SkeletalMesh->GetMaterials())
+		{
+			OutSlots.Emplace(SkeletalMaterial.MaterialSlotName, SkeletalMaterial.MaterialInterface);
+		}
+	}
+	else if (const UStaticMesh* StaticMesh = Cast<UStaticMesh>(Mesh))
+	{
+		for (const FStaticMaterial& StaticMaterial : StaticMesh->GetStaticMaterials())
+		{
+			OutSlots.Emplace(StaticMaterial.MaterialSlotName, StaticMaterial.MaterialInterface);
+		}
+	}
+}
+
+TArray<TArray<UStreamableRenderAsset*>> FUEMeshExportSession::PartitionMeshes(const TArray<UStreamableRenderAsset*>& Meshes, int32 NumShards)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UEMeshBPExport_PartitionMeshes);
+
+	// Union-find over meshes, materials and textures, every mesh joins the set of its materials and their textures
+	TMap<UObject*, int32> NodeIndices;
+	TArray<int32> Parents;
+	auto FindRoot = [&Parents](int32 Node)
+	{
+		while (Parents[Node] != Node)
+		{
+			Parents[Node] = Parents[Parents[Node]];
+			Node = Parents[Node];
+		}
+		return Node;
+	};
+	auto AddNode = [&NodeIndices, &Parents](UObject* Object)
+	{
+		if (const int32* Existing = NodeIndices.Find(Object))
+		{
+			return *Existing;
+		}
+		const int32 Node = Parents.Add(Parents.Num());
+		NodeIndices.Add(Object, Node);
+		return Node;
+	};
+
+	for (UStreamableRenderAsset* Mesh : Meshes)
+	{
+		const int32 MeshNode = AddNode(Mesh);
+
+		TArray<TPair<FName, UMaterialInterface*>> MaterialSlots;
+		GetMeshMaterialSlots(Mesh, MaterialSlots);
+		for (const TPair<FName, UMaterialInterface*>& MaterialSlot : MaterialSlots)
+		{
+			if (!MaterialSlot.Value)
+			{
+				continue;
+			}
+			const int32 MaterialNode = AddNode(MaterialSlot.Value);
+			Parents[FindRoot(MaterialNode)] = FindRoot(MeshNode);
+
+			TArray<TPair<FMaterialParameterInfo, UTexture2D*>> TextureParameters;
+			GetMaterialTextureParameters(MaterialSlot.Value, TextureParameters);
+			for (const TPair<FMaterialParameterInfo, UTexture2D*>& TextureParameter : TextureParameters)
+			{
+				const int32 TextureNode = AddNode(TextureParameter.Value);
+				Parents[FindRoot(TextureNode)] = FindRoot(MeshNode);
+			}
+		}
+	}
+
+	// Meshes and textures are what takes time to export, materials are only small JSON files
+	TMap<int32, TArray<UStreamableRenderAsset*>> Groups;
+	TMap<int32, int32> GroupWeights;
+	for (const TPair<UObject*, int32>& Node : NodeIndices)
+	{
+		const int32 Root = FindRoot(Node.Value);
+		if (UStreamableRenderAsset* Mesh = Cast<UStreamableRenderAsset>(Node.Key))
+		{
+			Groups.FindOrAdd(Root).Add(Mesh);
+			GroupWeights.FindOrAdd(Root)++;
+		}
+		else if (Node.Key->IsA<UTexture>())
+		{
+			GroupWeights.FindOrAdd(Root)++;
+		}
+	}
+
+	// Largest groups first, each into the lightest shard so far
+	TArray<int32> GroupRoots;
+	Groups.GetKeys(GroupRoots);
+	GroupRoots.Sort([&GroupWeights](int32 A, int32 B) { return GroupWeights[A] > GroupWeights[B]; });
+
+	TArray<TArray<UStreamableRenderAsset*>> Shards;
+	Shards.SetNum(FMath::Clamp(NumShards, 1, FMath::Max(GroupRoots.Num(), 1)));
+	TArray<int32> ShardWeights;
+	ShardWeights.SetNumZeroed(Shards.Num());
+	for (int32 Root : GroupRoots)
+	{
+		int32 LightestShard = 0;
+		for (int32 ShardIndex = 1; ShardIndex < Shards.Num(); ShardIndex++)
+		{
+			if (ShardWeights[ShardIndex] < ShardWeights[LightestShard])
+			{
+				LightestShard = ShardIndex;
+			}
+		}
+		Shards[LightestShard].Append(Groups[Root]);
+		ShardWeights[LightestShard] += GroupWeights[Root];
+	}
+
+	return Shards;
+}
+
+// Helper function: Process a single mesh
+const FUEMeshExportSession::FMeshRecord* FUEMeshExportSession::ProcessMesh(UStreamableRenderAsset* Mesh)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UEMeshBPExport_ProcessMesh);
+
+	TArray<UMaterialInterface*> Materials;
+	if (!ExportMeshFile(Mesh, Materials))
+	{
+		return nullptr;
+	}
+
+	for (UMaterialInterface* Material : Materials)
+	{
+		ExportMaterial(Material);
+	}
+	FinishMesh(Mesh);
+
+	return ProcessedMeshes.FindChecked(Mesh).GetPtrOrNull();
+}
+
+bool FUEMeshExportSession::ExportMeshFile(UStreamableRenderAsset* Mesh, TArray<UMaterialInterface*>& OutMaterials)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UEMeshBPExport_ExportMeshFile);
+
+	if (!Mesh)
+	{
+		return false;
+	}
+
+	if (const TOptional<FMeshRecord>* CachedRecord = ProcessedMeshes.Find(Mesh))
+	{
+		Stats.NumMeshesReused++;
+		return CachedRecord->IsSet();
+	}
+
+	TOptional<FMeshRecord>& Record = ProcessedMeshes.Add(Mesh);
+
+	// Get relative path and construct the mesh export path, the extension follows the chosen format
+	const bool bGlb = Options.MeshFormat == EUEMeshExportFormat::GLB;
+	const TCHAR* MeshFormatName = bGlb ? TEXT("glb") : TEXT("fbx");
+	FString MeshRelativePath = GetRelativePathFromGame(Mesh->GetPathName());
+	const FString MeshFileRelativePath = MeshRelativePath + TEXT(".") + MeshFormatName;
+	FString MeshFilePath = FPaths::Combine(ExportPath, MeshFileRelativePath);
+
+	// Ensure directory exists
+	EnsureDirectory(FPaths::GetPath(MeshFilePath));
+
+	const FString AssetKey = Mesh->GetPathName();
+	const FString SourceHash = FUEMeshExportStateCache::ComputeSourceHash(Mesh);
+	const uint32 OptionsHash = GetOptionsHash(MeshFormatName);
+	if (CheckUpToDate(AssetKey, SourceHash, OptionsHash, MeshFileRelativePath))
+	{
+		UE_LOG(LogUEMeshBPExport, Log, TEXT("Mesh file is up to date, skipping: %s"), *MeshFilePath);
+	}
+	else
+	{
+		// Export mesh to FBX or GLB
+		const double MeshStartTime = FPlatformTime::Seconds();
+		const bool bExported = bGlb ? ExportMeshToGlb(Mesh, MeshFilePath, 0, Options.bExportMorphTargets)
+			: ExportMeshToFBX(Mesh, MeshFilePath, Options.bExportLODs, Options.bExportMorphTargets);
+		Stats.MeshExportSeconds += FPlatformTime::Seconds() - MeshStartTime;
+
+		if (!bExported)
+		{
+			UE_LOG(LogUEMeshBPExport, Warning, TEXT("Failed to export mesh: %s"), *Mesh->GetName());
+			StateCache.Invalidate(AssetKey);
+			return false;
+		}
+		Stats.NumMeshes++;
+		INC_DWORD_STAT(STAT_UEMeshBPExport_MeshesExported);
+		AddBytesWritten(MeshFilePath);
+		StateCache.Record(AssetKey, SourceHash, OptionsHash, MeshFileRelativePath);
+	}
+
+	FMeshRecord NewRecord;
+	NewRecord.MeshName = Mesh->GetName();
+	NewRecord.MeshAssetPath = Mesh->GetPathName();
+	NewRecord.ExportedMeshPath = MeshFileRelativePath;
+	if (Options.bExportLODs)
+	{
+		ExportMeshLODs(Mesh, MeshRelativePath, SourceHash, NewRecord);
+	}
+
+	// Animations of the mesh reference the same skeleton file, the mesh file keeps its own copy of the bones
+	if (Options.bExportAnimations)
+	{
+		if (const USkeletalMesh* SkelMesh = Cast<USkeletalMesh>(Mesh))
+		{
+			NewRecord.SkeletonJsonPath = ExportSkeleton(SkelMesh->GetSkeleton());
+		}
+	}
+
+	// Material JSON paths are filled in by FinishMesh once the materials are exported
+	TArray<TPair<FName, UMaterialInterface*>> MaterialSlots;
+	GetMeshMaterialSlots(Mesh, MaterialSlots);
+	for (int32 MatIdx = 0; MatIdx < MaterialSlots.Num(); MatIdx++)
+	{
+		UMaterialInterface* Material = MaterialSlots[MatIdx].Value;
+		if (Material)
+		{
+			FMaterialRef& MaterialRef = NewRecord.Materials.AddDefaulted_GetRef();
+			MaterialRef.SlotIndex = MatIdx;
+			MaterialRef.SlotName = MaterialSlots[MatIdx].Key.ToString();
+			OutMaterials.Add(Material);
+		}
+	}
+
+	Record = MoveTemp(NewRecord);
+	return true;
+}
+
+void FUEMeshExportSession::ExportMeshLODs(UStreamableRenderAsset* Mesh, const FString& MeshRelativePath, const FString& SourceHash, FMeshRecord& OutRecord)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UEMeshBPExport_ExportMeshLODs);
+
+	const bool bGlb = Options.MeshFormat == EUEMeshExportFormat::GLB;
+	const uint32 OptionsHash = GetOptionsHash(TEXT("glb"));
+
+	const int32 NumLODs = GetMeshNumLODs(Mesh);
+	for (int32 LODIndex = 0; LODIndex < NumLODs; LODIndex++)
+	{
+		FLODRecord LODRecord;
+		GetMeshLODInfo(Mesh, LODIndex, LODRecord.ScreenSize, LODRecord.NumVertices, LODRecord.NumTriangles);
+
+		// FBX holds every LOD in the mesh file, GLB LOD 0 is the mesh file and the others get one file each
+		if (!bGlb || LODIndex == 0)
+		{
+			LODRecord.ExportedMeshPath = OutRecord.ExportedMeshPath;
+			OutRecord.LODs.Add(MoveTemp(LODRecord));
+			continue;
+		}
+
+		const FString LODFileRelativePath = FString::Printf(TEXT("%s_LOD%d.glb"), *MeshRelativePath, LODIndex);
+		const FString LODFilePath = FPaths::Combine(ExportPath, LODFileRelativePath);
+		const FString LODKey = FString::Printf(TEXT("%s:LOD%d"), *Mesh->GetPathName(), LODIndex);
+		if (CheckUpToDate(LODKey, SourceHash, OptionsHash, LODFileRelativePath))
+		{
+			UE_LOG(LogUEMeshBPExport, Log, TEXT("Mesh LOD file is up to date, skipping: %s"), *LODFilePath);
+		}
+		else
+		{
+			const double LODStartTime = FPlatformTime::Seconds();
+			const bool bExported = ExportMeshToGlb(Mesh, LODFilePath, LODIndex, Options.bExportMorphTargets);
+			Stats.MeshExportSeconds += FPlatformTime::Seconds() - LODStartTime;
+
+			// The mesh stays usable through its other LODs, a missing one is only left out of the manifest
+			if (!bExported)
+			{
+				UE_LOG(LogUEMeshBPExport, Warning, TEXT("Failed to export LOD %d of mesh: %s"), LODIndex, *Mesh->GetName());
+				StateCache.Invalidate(LODKey);
+				continue;
+			}
+			AddBytesWritten(LODFilePath);
+			StateCache.Record(LODKey, SourceHash, OptionsHash, LODFileRelativePath);
+		}
+
+		LODRecord.ExportedMeshPath = LODFileRelativePath;
+		OutRecord.LODs.Add(MoveTemp(LODRecord));
+	}
+}
+
+FString FUEMeshExportSession::ExportSkeleton(const USkeleton* Skeleton)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UEMeshBPExport_ExportSkeleton);
+
+	if (!Skeleton)
+	{
+		return FString();
+	}
+
+	if (const FString* CachedPath = ProcessedSkeletons.Find(Skeleton))
+	{
+		return *CachedPath;
+	}
+
+	FString& SkeletonJsonRelativePath = ProcessedSkeletons.Add(Skeleton);
+
+	const FString RelativePath = GetRelativePathFromGame(Skeleton->GetPathName()) + TEXT(".skeleton.json");
+	const FString SkeletonJsonPath = FPaths::Combine(ExportPath, RelativePath);
+	EnsureDirectory(FPaths::GetPath(SkeletonJsonPath));
+
+	const FString AssetKey = Skeleton->GetPathName();
+	const FString SourceHash = FUEMeshExportStateCache::ComputeSourceHash(Skeleton);
+	const uint32 OptionsHash = GetOptionsHash(TEXT("skeleton"));
+	if (CheckUpToDate(AssetKey, SourceHash, OptionsHash, RelativePath))
+	{
+		UE_LOG(LogUEMeshBPExport, Log, TEXT("Skeleton JSON is up to date, skipping: %s"), *SkeletonJsonPath);
+	}
+	else
+	{
+		const double SkeletonStartTime = FPlatformTime::Seconds();
+		const bool bWritten = WriteSkeletonFile(Skeleton, Options.bCompactJson, SkeletonJsonPath);
+		Stats.AnimationExportSeconds += FPlatformTime::Seconds() - SkeletonStartTime;
+
+		if (!bWritten)
+		{
+			UE_LOG(LogUEMeshBPExport, Warning, TEXT("Failed to export skeleton: %s"), *Skeleton->GetName());
+			StateCache.Invalidate(AssetKey);
+			return FString();
+		}
+		Stats.NumSkeletons++;
+		AddBytesWritten(SkeletonJsonPath);
+		StateCache.Record(AssetKey, SourceHash, OptionsHash, RelativePath);
+	}
+
+	SkeletonJsonRelativePath = RelativePath;
+	return SkeletonJsonRelativePath;
+}
+
+bool FUEMeshExportSession::ExportAnimation(UAnimSequence* Animation)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UEMeshBPExport_ExportAnimation);
+
+	if (!Animation)
+	{
+		return false;
+	}
+
+	if (const TOptional<FAnimationRecord>* CachedRecord = ProcessedAnimations.Find(Animation))
+	{
+		return CachedRecord->IsSet();
+	}
+
+	TOptional<FAnimationRecord>& Record = ProcessedAnimations.Add(Animation);
+
+	// Without its skeleton the bone indices of the tracks mean nothing, the animation is not written either
+	const FString SkeletonJsonPath = ExportSkeleton(Animation->GetSkeleton());
+	if (SkeletonJsonPath.IsEmpty())
+	{
+		UE_LOG(LogUEMeshBPExport, Warning, TEXT("Failed to export animation, its skeleton could not be exported: %s"), *Animation->GetName());
+		return false;
+	}
+
+	const FString AnimFileRelativePath = GetRelativePathFromGame(Animation->GetPathName()) + TEXT(".umba");
+	const FString AnimFilePath = FPaths::Combine(ExportPath, AnimFileRelativePath);
+	EnsureDirectory(FPaths::GetPath(AnimFilePath));
+
+	const FString AssetKey = Animation->GetPathName();
+	const FString SourceHash = FUEMeshExportStateCache::ComputeSourceHash(Animation);
+	const uint32 OptionsHash = GetOptionsHash(TEXT("animation"));
+	if (CheckUpToDate(AssetKey, SourceHash, OptionsHash, AnimFileRelativePath))
+	{
+		UE_LOG(LogUEMeshBPExport, Log, TEXT("Animation file is up to date, skipping: %s"), *AnimFilePath);
+	}
+	else
+	{
+		const double AnimStartTime = FPlatformTime::Seconds();
+		FUEMeshAnimationFileInfo FileInfo;
+		const bool bExported = WriteAnimationFile(Animation, Options.AnimationKeyTolerance, Options.bQuantizeAnimations, AnimFilePath, FileInfo);
+		Stats.AnimationExportSeconds += FPlatformTime::Seconds() - AnimStartTime;
+
+		if (!bExported)
+		{
+			UE_LOG(LogUEMeshBPExport, Warning, TEXT("Failed to export animation: %s"), *Animation->GetName());
+			StateCache.Invalidate(AssetKey);
+			return false;
+		}
+		Stats.NumAnimations++;
+		AddBytesWritten(AnimFilePath);
+		StateCache.Record(AssetKey, SourceHash, OptionsHash, AnimFileRelativePath);
+	}
+
+	FAnimationRecord NewRecord;
+	NewRecord.AnimName = Animation->GetName();
+	NewRecord.AnimAssetPath = Animation->GetPathName();
+	NewRecord.ExportedAnimPath = AnimFileRelativePath;
+	NewRecord.SkeletonJsonPath = SkeletonJsonPath;
+	NewRecord.NumFrames = Animation->GetNumberOfSampledKeys();
+	NewRecord.FrameRate = static_cast<float>(Animation->GetSamplingFrameRate().AsDecimal());
+	Record = MoveTemp(NewRecord);
+	return true;
+}
+
+void FUEMeshExportSession::WriteAnimationIndex()
+{
+	const double ManifestStartTime = FPlatformTime::Seconds();
+
+	// Sorted so the file only changes when the set of animations does
+	TArray<const FAnimationRecord*> AnimationRecords;
+	for (const TPair<UAnimSequence*, TOptional<FAnimationRecord>>& AnimationPair : ProcessedAnimations)
+	{
+		if (AnimationPair.Value.IsSet())
+		{
+			AnimationRecords.Add(AnimationPair.Value.GetPtrOrNull());
+		}
+	}
+	AnimationRecords.Sort([](const FAnimationRecord& A, const FAnimationRecord& B) { return A.AnimAssetPath < B.AnimAssetPath; });
+
+	const FString AnimationIndexPath = FPaths::Combine(ExportPath, TEXT("animations.json"));
+	const bool bSaved = WriteJsonFile(AnimationIndexPath, Options.bCompactJson, [&](auto& JsonWriter)
+	{
+		JsonWriter.WriteObjectStart();
+		JsonWriter.WriteArrayStart(TEXT("Animations"));
+		for (const FAnimationRecord* AnimationRecord : AnimationRecords)
+		{
+			JsonWriter.WriteObjectStart();
+			JsonWriter.WriteValue(TEXT("AnimName"), AnimationRecord->AnimName);
+			JsonWriter.WriteValue(TEXT("AnimAssetPath"), AnimationRecord->AnimAssetPath);
+			JsonWriter.WriteValue(TEXT("ExportedAnimPath"), AnimationRecord->ExportedAnimPath);
+			JsonWriter.WriteValue(TEXT("SkeletonJSONPath"), AnimationRecord->SkeletonJsonPath);
+			JsonWriter.WriteValue(TEXT("NumFrames"), AnimationRecord->NumFrames);
+			JsonWriter.WriteValue(TEXT("FrameRate"), AnimationRecord->FrameRate);
+			JsonWriter.WriteObjectEnd();
+		}
+		JsonWriter.WriteArrayEnd();
+		JsonWriter.WriteObjectEnd();
+	});
+	Stats.ManifestWriteSeconds += FPlatformTime::Seconds() - ManifestStartTime;
+
+	if (bSaved)
+	{
+		AddBytesWritten(AnimationIndexPath);
+	}
+	else
+	{
+		UE_LOG(LogUEMeshBPExport, Error, TEXT("ExportSkelMeshes: Failed to write animation index: %s"), *AnimationIndexPath);
+	}
+}
+
+bool FUEMeshExportSession::ExportMaterial(UMaterialInterface* Material, bool* bOutDeferred)
+{
+	return !ExportMaterialToJSON(Material, bOutDeferred).IsEmpty();
+}
+
+void FUEMeshExportSession::FinishMesh(UStreamableRenderAsset* Mesh)
+{
+	TOptional<FMeshRecord>* Record = ProcessedMeshes.Find(Mesh);
+	if (!Record || !Record->IsSet() || (*Record)->bFinished)
+	{
+		return;
+	}
+
+	FMeshRecord& MeshRecord = Record->GetValue();
+	TArray<TPair<FName, UMaterialInterface*>> MaterialSlots;
+	GetMeshMaterialSlots(Mesh, MaterialSlots);
+	for (FMaterialRef& MaterialRef : MeshRecord.Materials)
+	{
+		UMaterialInterface* Material = MaterialSlots.IsValidIndex(MaterialRef.SlotIndex) ? MaterialSlots[MaterialRef.SlotIndex].Value : nullptr;
+		if (const FString* MaterialJsonPath = ProcessedMaterials.Find(Material))
+		{
+			MaterialRef.MaterialJsonPath = *MaterialJsonPath;
+		}
+	}
+	MeshRecord.bFinished = true;
+
+	if (Options.bWriteBinaryManifest)
+	{
+		FUEMeshBinaryManifest::FMesh& BinaryMesh = BinaryManifest.Meshes.Add(MeshRecord.ExportedMeshPath);
+		BinaryMesh.MeshName = MeshRecord.MeshName;
+		BinaryMesh.MeshAssetPath = MeshRecord.MeshAssetPath;
+		for (const FMaterialRef& MaterialRef : MeshRecord.Materials)
+		{
+			BinaryMesh.MaterialRefs.Add({ MaterialRef.SlotIndex, MaterialRef.SlotName, MaterialRef.MaterialJsonPath });
+		}
+		for (const FLODRecord& LODRecord : MeshRecord.LODs)
+		{
+			BinaryMesh.LODs.Add({ LODRecord.ExportedMeshPath, LODRecord.ScreenSize, LODRecord.NumVertices, LODRecord.NumTriangles });
+		}
+	}
+}
+
+// Helper function: Sequence a skeletal mesh component plays in single node mode, null for animation blueprints
+static UAnimSequence* GetPlayingAnimation(USkeletalMeshComponent* SkelMeshComp)
+{
+	if (SkelMeshComp->GetAnimationMode() != EAnimationMode::AnimationSingleNode)
+	{
+		return nullptr;
+	}
+
+	// The instance only exists once the component is initialized, in the editor world the serialized settings are what is set
+	if (const UAnimSingleNodeInstance* SingleNodeInstance = SkelMeshComp->GetSingleNodeInstance())
+	{
+		if (UAnimSequence* Animation = Cast<UAnimSequence>(SingleNodeInstance->GetAnimationAsset()))
+		{
+			return Animation;
+		}
+	}
+	return Cast<UAnimSequence>(SkelMeshComp->AnimationData.AnimToPlay);
+}
+
+// Helper function: Components of an actor, of its child actors and of every actor attached to it, recursively
+template <typename ComponentType>
+static void GetHierarchyComponents(AActor* Actor, TArray<ComponentType*>& OutComponents)
+{
+	TArray<AActor*> HierarchyActors;
+	HierarchyActors.Add(Actor);
+	Actor->GetAttachedActors(HierarchyActors, false, true);
+
+	// Child actors are attached to their component as well, so their components are seen twice
+	TSet<UActorComponent*> SeenComponents;
+	for (AActor* HierarchyActor : HierarchyActors)
+	{
+		TArray<ComponentType*> ActorComponents;
+		HierarchyActor->GetComponents(ActorComponents, true);
+		for (ComponentType* Component : ActorComponents)
+		{
+			bool bAlreadySeen = false;
+			SeenComponents.Add(Component, &bAlreadySeen);
+			if (!bAlreadySeen)
+			{
+				OutComponents.Add(Component);
+			}
+		}
+	}
+}
+
+bool FUEMeshExportSession::CollectActorMeshes(AActor* Actor, TArray<UStreamableRenderAsset*>& OutMeshes)
+{
+	if (!Actor)
+	{
+		UE_LOG(LogUEMeshBPExport, Error, TEXT("ExportSkelMeshes: Actor is null"));
+		return false;
+	}
+
+	FActorMeshes& ActorMeshes = CollectedActors.Add(Actor);
+
+	// Get all skeletal mesh components
+	TArray<USkeletalMeshComponent*> SkelMeshComponents;
+	GetHierarchyComponents(Actor, SkelMeshComponents);
+
+	// Track meshes of this actor to avoid duplicate manifest entries
+	for (USkeletalMeshComponent* SkelMeshComp : SkelMeshComponents)
+	{
+		if (!SkelMeshComp || !SkelMeshComp->GetSkeletalMeshAsset())
+		{
+			continue;
+		}
+
+		USkeletalMesh* SkelMesh = Cast<USkeletalMesh>(SkelMeshComp->GetSkeletalMeshAsset());
+		if (SkelMesh)
+		{
+			const int32 MeshIndex = ActorMeshes.SkeletalMeshes.AddUnique(SkelMesh);
+			if (Options.bExportAnimations)
+			{
+				if (MeshIndex == ActorMeshes.SkeletalMeshAnimations.Num())
+				{
+					ActorMeshes.SkeletalMeshAnimations.AddDefaulted();
+				}
+				if (UAnimSequence* Animation = GetPlayingAnimation(SkelMeshComp))
+				{
+					ActorMeshes.SkeletalMeshAnimations[MeshIndex].AddUnique(Animation);
+				}
+			}
+		}
+	}
+
+	// Static mesh components and instances only add a transform per placement, the mesh itself is listed once
+	if (Options.bExportStaticMeshes)
+	{
+		TArray<UStaticMeshComponent*> StaticMeshComponents;
+		GetHierarchyComponents(Actor, StaticMeshComponents);
+
+		for (UStaticMeshComponent* StaticMeshComp : StaticMeshComponents)
+		{
+			UStaticMesh* StaticMesh = StaticMeshComp ? StaticMeshComp->GetStaticMesh() : nullptr;
+			if (!StaticMesh)
+			{
+				continue;
+			}
+
+			const int32 MeshIndex = ActorMeshes.StaticMeshes.AddUnique(StaticMesh);
+			if (MeshIndex == ActorMeshes.StaticMeshInstances.Num())
+			{
+				ActorMeshes.StaticMeshInstances.AddDefaulted();
+			}
+			TArray<FTransform>& Instances = ActorMeshes.StaticMeshInstances[MeshIndex];
+
+			if (const UInstancedStaticMeshComponent* InstancedComp = Cast<UInstancedStaticMeshComponent>(StaticMeshComp))
+			{
+				const int32 NumInstances = InstancedComp->GetInstanceCount();
+				Instances.Reserve(Instances.Num() + NumInstances);
+				for (int32 InstanceIndex = 0; InstanceIndex < NumInstances; InstanceIndex++)
+				{
+					InstancedComp->GetInstanceTransform(InstanceIndex, Instances.AddDefaulted_GetRef(), true);
+				}
+			}
+			else
+			{
+				Instances.Add(StaticMeshComp->GetComponentTransform());
+			}
+		}
+	}
+
+	if (ActorMeshes.SkeletalMeshes.Num() == 0 && ActorMeshes.StaticMeshes.Num() == 0)
+	{
+		UE_LOG(LogUEMeshBPExport, Warning, TEXT("ExportSkelMeshes: No mesh component found in Actor %s"), *Actor->GetName());
+		CollectedActors.Remove(Actor);
+		return false;
+	}
+
+	OutMeshes.Append(ActorMeshes.SkeletalMeshes);
+	OutMeshes.Append(ActorMeshes.StaticMeshes);
+	return true;
+}
+
+bool FUEMeshExportSession::ExportActor(AActor* Actor, const FString& ExportName)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UEMeshBPExport_ExportActor);
+
+	TArray<UStreamableRenderAsset*> ActorMeshes;
+	if (!CollectActorMeshes(Actor, ActorMeshes))
+	{
+		return false;
+	}
+
+	// Process each unique mesh
+	for (UStreamableRenderAsset* Mesh : ActorMeshes)
+	{
+		ProcessMesh(Mesh);
+	}
+
+	return WriteActorManifest(Actor, ExportName);
+}
+
+// Helper function: Write the mesh, mesh file and material slot fields shared by skeletal and static mesh entries
+template <typename JsonWriterType, typename MeshRecordType>
+static void WriteMeshRecordFields(JsonWriterType& JsonWriter, const MeshRecordType& MeshRecord)
+{
+	JsonWriter.WriteValue(TEXT("MeshName"), MeshRecord.MeshName);
+	JsonWriter.WriteValue(TEXT("MeshAssetPath"), MeshRecord.MeshAssetPath);
+	JsonWriter.WriteValue(TEXT("ExportedMeshPath"), MeshRecord.ExportedMeshPath);
+
+	// Kept for readers of manifests from before GLB export, only ever points at an FBX
+	if (MeshRecord.ExportedMeshPath.EndsWith(TEXT(".fbx")))
+	{
+		JsonWriter.WriteValue(TEXT("ExportedFBXPath"), MeshRecord.ExportedMeshPath);
+	}
+
+	JsonWriter.WriteArrayStart(TEXT("Materials"));
+	for (const auto& MaterialRef : MeshRecord.Materials)
+	{
+		JsonWriter.WriteObjectStart();
+		JsonWriter.WriteValue(TEXT("MaterialSlotIndex"), MaterialRef.SlotIndex);
+		JsonWriter.WriteValue(TEXT("MaterialSlotName"), MaterialRef.SlotName);
+		if (!MaterialRef.MaterialJsonPath.IsEmpty())
+		{
+			JsonWriter.WriteValue(TEXT("MaterialJSONPath"), MaterialRef.MaterialJsonPath);
+		}
+		JsonWriter.WriteObjectEnd();
+	}
+	JsonWriter.WriteArrayEnd();
+
+	// Only with bExportLODs, a loader can budget every LOD before opening any file
+	if (MeshRecord.LODs.Num() > 0)
+	{
+		JsonWriter.WriteArrayStart(TEXT("LODs"));
+		for (int32 LODIndex = 0; LODIndex < MeshRecord.LODs.Num(); LODIndex++)
+		{
+			const auto& LODRecord = MeshRecord.LODs[LODIndex];
+			JsonWriter.WriteObjectStart();
+			JsonWriter.WriteValue(TEXT("LODIndex"), LODIndex);
+			JsonWriter.WriteValue(TEXT("ExportedMeshPath"), LODRecord.ExportedMeshPath);
+			JsonWriter.WriteValue(TEXT("ScreenSize"), LODRecord.ScreenSize);
+			JsonWriter.WriteValue(TEXT("NumVertices"), LODRecord.NumVertices);
+			JsonWriter.WriteValue(TEXT("NumTriangles"), LODRecord.NumTriangles);
+			JsonWriter.WriteObjectEnd();
+		}
+		JsonWriter.WriteArrayEnd();
+	}
+}
+
+bool FUEMeshExportSession::WriteActorManifest(AActor* Actor, const FString& ExportName)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UEMeshBPExport_WriteActorManifest);
+
+	FActorMeshes ActorMeshes;
+	if (!Actor || !CollectedActors.RemoveAndCopyValue(Actor, ActorMeshes))
+	{
+		UE_LOG(LogUEMeshBPExport, Error, TEXT("ExportSkelMeshes: Meshes of the actor were not collected"));
+		return false;
+	}
+
+	// Meshes that failed to export are left out of the manifest
+	auto IsExported = [this](UStreamableRenderAsset* Mesh)
+	{
+		const TOptional<FMeshRecord>* Record = ProcessedMeshes.Find(Mesh);
+		return Record && Record->IsSet();
+	};
+
+	TArray<int32> ExportedMeshes;
+	for (int32 MeshIndex = 0; MeshIndex < ActorMeshes.SkeletalMeshes.Num(); MeshIndex++)
+	{
+		if (IsExported(ActorMeshes.SkeletalMeshes[MeshIndex]))
+		{
+			ExportedMeshes.Add(MeshIndex);
+		}
+	}
+
+	// Animations failing to export are left out like meshes, the mesh itself is still listed
+	for (const TArray<UAnimSequence*>& Animations : ActorMeshes.SkeletalMeshAnimations)
+	{
+		for (UAnimSequence* Animation : Animations)
+		{
+			ExportAnimation(Animation);
+		}
+	}
+
+	// Resolved only once every animation is in ProcessedAnimations, adding to it moves the records
+	TArray<TArray<const FAnimationRecord*>> ExportedAnimations;
+	ExportedAnimations.SetNum(ActorMeshes.SkeletalMeshes.Num());
+	for (int32 MeshIndex = 0; MeshIndex < ActorMeshes.SkeletalMeshAnimations.Num(); MeshIndex++)
+	{
+		for (UAnimSequence* Animation : ActorMeshes.SkeletalMeshAnimations[MeshIndex])
+		{
+			if (const FAnimationRecord* AnimationRecord = ProcessedAnimations.FindChecked(Animation).GetPtrOrNull())
+			{
+				ExportedAnimations[MeshIndex].Add(AnimationRecord);
+			}
+		}
+	}
+
+	TArray<int32> ExportedStaticMeshes;
+	for (int32 MeshIndex = 0; MeshIndex < ActorMeshes.StaticMeshes.Num(); MeshIndex++)
+	{
+		if (IsExported(ActorMeshes.StaticMeshes[MeshIndex]))
+		{
+			ExportedStaticMeshes.Add(MeshIndex);
+		}
+	}
+
+	// Every texture referenced by the manifest must be on disk before it is written
+	FlushTextureWrites();
+
+	const double ManifestStartTime = FPlatformTime::Seconds();
+
+	// Save actor JSON
+	FString ActorJsonPath = FPaths::Combine(ExportPath, ExportName + TEXT(".json"));
+	const bool bSaved = WriteJsonFile(ActorJsonPath, Options.bCompactJson, [&](auto& JsonWriter)
+	{
+		JsonWriter.WriteObjectStart();
+		JsonWriter.WriteValue(TEXT("ActorName"), Actor->GetName());
+
+		JsonWriter.WriteArrayStart(TEXT("SkeletalMeshes"));
+		for (int32 MeshIndex : ExportedMeshes)
+		{
+			const FMeshRecord& MeshRecord = ProcessedMeshes.FindChecked(ActorMeshes.SkeletalMeshes[MeshIndex]).GetValue();
+
+			JsonWriter.WriteObjectStart();
+			WriteMeshRecordFields(JsonWriter, MeshRecord);
+
+			// Only with bExportAnimations, the skeleton file is shared by every mesh and animation of the skeleton
+			if (!MeshRecord.SkeletonJsonPath.IsEmpty())
+			{
+				JsonWriter.WriteValue(TEXT("SkeletonJSONPath"), MeshRecord.SkeletonJsonPath);
+			}
+			if (ExportedAnimations[MeshIndex].Num() > 0)
+			{
+				JsonWriter.WriteArrayStart(TEXT("Animations"));
+				for (const FAnimationRecord* AnimationRecord : ExportedAnimations[MeshIndex])
+				{
+					JsonWriter.WriteObjectStart();
+					JsonWriter.WriteValue(TEXT("AnimName"), AnimationRecord->AnimName);
+					JsonWriter.WriteValue(TEXT("AnimAssetPath"), AnimationRecord->AnimAssetPath);
+					JsonWriter.WriteValue(TEXT("ExportedAnimPath"), AnimationRecord->ExportedAnimPath);
+					JsonWriter.WriteObjectEnd();
+				}
+				JsonWriter.WriteArrayEnd();
+			}
+
+			JsonWriter.WriteObjectEnd();
+		}
+		JsonWriter.WriteArrayEnd();
+
+		// Placements are a flat array of world transforms, ten numbers each: location XYZ, rotation quaternion XYZW, scale XYZ
+		if (ExportedStaticMeshes.Num() > 0)
+		{
+			JsonWriter.WriteArrayStart(TEXT("StaticMeshes"));
+			for (int32 MeshIndex : ExportedStaticMeshes)
+			{
+				const TArray<FTransform>& Instances = ActorMeshes.StaticMeshInstances[MeshIndex];
+
+				JsonWriter.WriteObjectStart();
+				WriteMeshRecordFields(JsonWriter, ProcessedMeshes.FindChecked(ActorMeshes.StaticMeshes[MeshIndex]).GetValue());
+				JsonWriter.WriteValue(TEXT("NumInstances"), Instances.Num());
+
+				JsonWriter.WriteArrayStart(TEXT("Transforms"));
+				for (const FTransform& Instance : Instances)
+				{
+					const FVector Location = Instance.GetLocation();
+					const FQuat Rotation = Instance.GetRotation();
+					const FVector Scale = Instance.GetScale3D();
+					const double Values[] = { Location.X, Location.Y, Location.Z, Rotation.X, Rotation.Y, Rotation.Z, Rotation.W, Scale.X, Scale.Y, Scale.Z };
+					for (double Value : Values)
+					{
+						JsonWriter.WriteValue(Value);
+					}
+				}
+				JsonWriter.WriteArrayEnd();
+
+				JsonWriter.WriteObjectEnd();
+			}
+			JsonWriter.WriteArrayEnd();
+		}
+
+		JsonWriter.WriteObjectEnd();
+	});
+	Stats.ManifestWriteSeconds += FPlatformTime::Seconds() - ManifestStartTime;
+
+	if (Options.bWriteBinaryManifest)
+	{
+		FUEMeshBinaryManifest::FActor& BinaryActor = BinaryManifest.Actors.Add(ExportName);
+		BinaryActor.ActorName = Actor->GetName();
+		for (int32 MeshIndex : ExportedMeshes)
+		{
+			BinaryActor.MeshPaths.Add(ProcessedMeshes.FindChecked(ActorMeshes.SkeletalMeshes[MeshIndex])->ExportedMeshPath);
+		}
+		for (int32 MeshIndex : ExportedStaticMeshes)
+		{
+			BinaryActor.MeshPaths.Add(ProcessedMeshes.FindChecked(ActorMeshes.StaticMeshes[MeshIndex])->ExportedMeshPath);
+		}
+	}
+
+	if (bSaved)
+	{
+		Stats.NumActors++;
+		AddBytesWritten(ActorJsonPath);
+		UE_LOG(LogUEMeshBPExport, Log, TEXT("ExportSkelMeshes: Successfully exported actor JSON to: %s"), *ActorJsonPath);
+		return true;
+	}
+	else
+	{
+		UE_LOG(LogUEMeshBPExport, Error, TEXT("ExportSkelMeshes: Failed to export actor JSON to: %s"), *ActorJsonPath);
+		return false;
+	}
+}
+#endif
@@ -0,0 +1,256 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UEMeshBPExportFuncsTypes.h"
+#include "ImageCore.h"
+#include "Async/Future.h"
+#include "UEMeshExportStateCache.h"
+#include "UEMeshBinaryManifest.h"
+
+#if WITH_EDITOR
+class AActor;
+class USkeletalMesh;
+class UStaticMesh;
+class UStreamableRenderAsset;
+class UMaterialInterface;
+class UTexture;
+class UTexture2D;
+class UAnimSequence;
+class USkeleton;
+
+/*
+*	Export state shared by every actor written in one run.
+*	Meshes, materials and textures are exported at most once per session, every actor manifest
+*	that references them afterwards reuses the cached result instead of touching the disk again.
+*/
+class FUEMeshExportSession
+{
+public:
+	FUEMeshExportSession(const FString& InExportPath, const FUEMeshExportOptions& InOptions);
+
+	/** Creates the export root. Must succeed before any actor is exported. */
+	bool Initialize();
+
+	/** Exports all skeletal and static meshes of Actor and writes <ExportName>.json into the export root */
+	bool ExportActor(AActor* Actor, const FString& ExportName);
+
+	/*
+	*	Work items ExportActor is made of, for callers that spread an export over several frames:
+	*	CollectActorMeshes, then per mesh ExportMeshFile, ExportMaterial for every returned material and FinishMesh,
+	*	and WriteActorManifest once no texture write is pending any more (see PollTextureWrites).
+	*/
+
+	/**
+	*	Collects the unique skeletal and static meshes of Actor, its child actors and every actor attached to it, and the
+	*	placements of its static meshes for WriteActorManifest. OutMeshes receives every unique mesh, returns false if there is none.
+	*/
+	bool CollectActorMeshes(AActor* Actor, TArray<UStreamableRenderAsset*>& OutMeshes);
+
+	/**
+	*	Writes the FBX or GLB file of a skeletal or static mesh not exported by this session yet. OutMaterials receives its slot materials,
+	*	which have to be passed to ExportMaterial before FinishMesh. Returns false if the mesh could not be exported, now or earlier.
+	*/
+	bool ExportMeshFile(UStreamableRenderAsset* Mesh, TArray<UMaterialInterface*>& OutMaterials);
+
+	/**
+	*	Writes the material JSON and queues its textures, returns false if the JSON could not be written. Waits for a queued
+	*	texture write to finish whenever the queue is full, unless bOutDeferred is passed: then the export stops there and sets
+	*	it, and calling again after PollTextureWrites continues with the textures not queued yet.
+	*/
+	bool ExportMaterial(UMaterialInterface* Material, bool* bOutDeferred = nullptr);
+
+	/** Resolves the material JSON paths of a mesh written by ExportMeshFile and completes its record */
+	void FinishMesh(UStreamableRenderAsset* Mesh);
+
+	/**
+	*	Writes the animation file of a sequence and the JSON of its skeleton, each once per session. Returns false if the
+	*	animation could not be exported, now or earlier. Actor animations are exported by WriteActorManifest.
+	*/
+	bool ExportAnimation(UAnimSequence* Animation);
+
+	/**
+	*	Writes <ExportName>.json for the meshes collected from Actor, waiting for every queued texture write first.
+	*	With bExportAnimations the animations the actor plays are exported first.
+	*/
+	bool WriteActorManifest(AActor* Actor, const FString& ExportName);
+
+	/** Records the texture writes that have finished without waiting for the others, returns the number still running */
+	int32 PollTextureWrites();
+
+	/** Closes the session, writes animations.json and the binary manifest if enabled and finalizes the total time */
+	void Finish();
+
+	/**
+	*	Makes Finish write only the export state recorded by this session into FilePath instead of the state file of the
+	*	export root, for worker processes exporting a shard of a sharded export. See FUEMeshExportStateCache::SaveChanges.
+	*/
+	void SetStateChangesFile(const FString& FilePath) { StateChangesFile = FilePath; }
+
+	/**
+	*	Splits Meshes into at most NumShards lists that can be exported by separate processes into the same export root.
+	*	Meshes sharing a material, or materials sharing a texture, always end up in the same list, so no two processes write
+	*	the same file. The lists are balanced by the number of meshes and textures in them.
+	*/
+	static TArray<TArray<UStreamableRenderAsset*>> PartitionMeshes(const TArray<UStreamableRenderAsset*>& Meshes, int32 NumShards);
+
+	const FUEMeshExportStats& GetStats() const { return Stats; }
+
+private:
+	struct FMaterialRef
+	{
+		int32 SlotIndex = INDEX_NONE;
+		FString SlotName;
+		FString MaterialJsonPath;
+	};
+
+	struct FLODRecord
+	{
+		/** Relative to the export root, the mesh file itself for FBX and for LOD 0 */
+		FString ExportedMeshPath;
+		float ScreenSize = 0.0f;
+		int32 NumVertices = 0;
+		int32 NumTriangles = 0;
+	};
+
+	struct FMeshRecord
+	{
+		FString MeshName;
+		FString MeshAssetPath;
+		/** Relative to the export root, .fbx or .glb */
+		FString ExportedMeshPath;
+		TArray<FMaterialRef> Materials;
+		/** Every LOD of the render data, only with bExportLODs */
+		TArray<FLODRecord> LODs;
+		/** Skeletal meshes with bExportAnimations only, relative to the export root */
+		FString SkeletonJsonPath;
+		/** Set by FinishMesh once the material JSON paths are known */
+		bool bFinished = false;
+	};
+
+	struct FAnimationRecord
+	{
+		FString AnimName;
+		FString AnimAssetPath;
+		/** Relative to the export root, .umba */
+		FString ExportedAnimPath;
+		FString SkeletonJsonPath;
+		int32 NumFrames = 0;
+		float FrameRate = 0.0f;
+	};
+
+	/** Meshes of an actor between CollectActorMeshes and WriteActorManifest */
+	struct FActorMeshes
+	{
+		TArray<USkeletalMesh*> SkeletalMeshes;
+		/** Sequences the components showing the skeletal mesh of the same index play, only with bExportAnimations */
+		TArray<TArray<UAnimSequence*>> SkeletalMeshAnimations;
+		TArray<UStaticMesh*> StaticMeshes;
+		/** World transforms of every component and instance placing the static mesh of the same index */
+		TArray<TArray<FTransform>> StaticMeshInstances;
+	};
+
+	/** Exports a mesh and its materials, returns null if the mesh could not be exported */
+	const FMeshRecord* ProcessMesh(UStreamableRenderAsset* Mesh);
+
+	/** Writes the LOD files of a GLB mesh beyond LOD 0 and fills the LOD records of a mesh exported by ExportMeshFile */
+	void ExportMeshLODs(UStreamableRenderAsset* Mesh, const FString& MeshRelativePath, const FString& SourceHash, FMeshRecord& OutRecord);
+
+	/** Writes the JSON of a skeleton once per session, returns its path relative to the export root or empty on failure */
+	FString ExportSkeleton(const USkeleton* Skeleton);
+
+	/** Writes <ExportPath>/animations.json listing every animation of the session */
+	void WriteAnimationIndex();
+
+	/** Writes the material JSON and its textures once per session, returns the JSON path relative to the export root */
+	FString ExportMaterialToJSON(UMaterialInterface* Material, bool* bOutDeferred = nullptr);
+
+	/** Collects the material parameters and writes them to <ExportPath>/<MaterialPath>_material.json, see ExportMaterial for bOutDeferred */
+	FString WriteMaterialJSON(UMaterialInterface* Material, bool* bOutDeferred);
+
+	struct FPendingTextureWrite
+	{
+		FString AssetKey;
+		FString SourceHash;
+		uint32 OptionsHash = 0;
+		FString RelativeOutputPath;
+		TFuture<FString> Result;
+		/** Asset key and source hash of textures with the same content that reference this file */
+		TArray<TPair<FString, FString>> SharedBy;
+	};
+
+	struct FSharedTexture
+	{
+		FString RelativeOutputPath;
+		FString OwnerKey;
+	};
+
+	/**
+	*	Exports a texture once per session and stores the file it references in TextureOutputPaths. The file is encoded and
+	*	written asynchronously, see FlushTextureWrites. A texture with the same content as one exported before in this session
+	*	references that file instead of writing its own. Without bWaitForQueue nothing is done and false is returned while
+	*	the write queue is full.
+	*/
+	bool ExportTexture(UTexture2D* Texture, bool bWaitForQueue = true);
+
+	/** True if the texture OwnerKey still is what wrote RelativeOutputPath, i.e. textures sharing that file can skip export */
+	bool IsSharedTextureUpToDate(const FString& OwnerKey, uint32 OptionsHash, const FString& RelativeOutputPath);
+
+	/** Records a texture that references the file of OwnerKey, after that file has been written */
+	void RecordSharedTexture(const FString& AssetKey, const FString& SourceHash, uint32 OptionsHash, const FString& OwnerKey);
+
+	/** True if QueueTextureWrite would have to wait for a queued write to finish first */
+	bool IsTextureQueueFull() const;
+
+	/** Hands a decoded source image to the thread pool for resizing to TargetSizeX x TargetSizeY, encoding and file write */
+	void QueueTextureWrite(FImage&& SourceImage, int32 TargetSizeX, int32 TargetSizeY, FPendingTextureWrite&& PendingWrite);
+
+	/** Blocks until a queued texture write has finished and records its result */
+	void CompleteTextureWrite(FPendingTextureWrite& PendingWrite);
+
+	/** Blocks until every queued texture write has finished */
+	void FlushTextureWrites();
+
+	/** Hash of everything besides the source asset that affects the content of an output kind */
+	uint32 GetOptionsHash(const TCHAR* OutputKind) const;
+
+	/** Asks the state cache whether an output is current and counts the hit or miss */
+	bool CheckUpToDate(const FString& AssetKey, const FString& SourceHash, uint32 OptionsHash, const FString& RelativeOutputPath);
+
+	/** Adds the size of a written file to the stats */
+	void AddBytesWritten(const FString& FilePath);
+
+	/** Creates Directory unless this session already did */
+	void EnsureDirectory(const FString& Directory);
+
+	FString ExportPath;
+	FUEMeshExportOptions Options;
+
+	/** Failed meshes are cached as unset so they are not retried for every actor */
+	TMap<UStreamableRenderAsset*, TOptional<FMeshRecord>> ProcessedMeshes;
+	TMap<UMaterialInterface*, FString> ProcessedMaterials;
+	/** Materials whose export stopped at a full texture queue, with the number of texture parameters already exported */
+	TMap<UMaterialInterface*, int32> DeferredMaterials;
+	/** Failed animations are cached as unset, like meshes */
+	TMap<UAnimSequence*, TOptional<FAnimationRecord>> ProcessedAnimations;
+	/** Failed skeletons are cached as empty paths */
+	TMap<const USkeleton*, FString> ProcessedSkeletons;
+	/** Export path of every texture seen, relative to the export root. Differs from the texture's own path when deduplicated. */
+	TMap<UTexture*, FString> TextureOutputPaths;
+	/** Textures written by this session by content key, see GetTextureContentKey */
+	TMap<uint64, FSharedTexture> TexturesByContent;
+	TSet<FString> KnownDirectories;
+	TMap<AActor*, FActorMeshes> CollectedActors;
+	TArray<FPendingTextureWrite> PendingTextureWrites;
+	FUEMeshExportStateCache StateCache;
+	/** Set for shard workers, see SetStateChangesFile */
+	FString StateChangesFile;
+
+	/** Records of the previous export merged with everything this session exported, only used with bWriteBinaryManifest */
+	FUEMeshBinaryManifest BinaryManifest;
+
+	FUEMeshExportStats Stats;
+	double StartTime = 0.0;
+};
+#endif
@@ -0,0 +1,374 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "UEMeshExportStateCache.h"
+#include "UEMeshBPExportFuncs.h"
+
+#if WITH_EDITOR
+#include "Engine/Texture.h"
+#include "Materials/MaterialInstance.h"
+#include "Animation/AnimSequence.h"
+#include "Animation/Skeleton.h"
+#include "UObject/Package.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/SecureHash.h"
+#include "HAL/PlatformFileManager.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "UEMeshJsonFileWriter.h"
+
+static const TCHAR* ExportStateFileName = TEXT(".uemeshexport_state.json");
+static const int32 ExportStateVersion = 1;
+
+// Helper function: Hash of the saved package of an object, empty if the package has unsaved changes
+static FString GetSavedPackageHash(const UObject* Object)
+{
+	const UPackage* Package = Object ? Object->GetPackage() : nullptr;
+	if (!Package || Package->IsDirty() || Package->GetSavedHash().IsZero())
+	{
+		return FString();
+	}
+	return LexToString(Package->GetSavedHash());
+}
+
+TSharedPtr<FJsonObject> FUEMeshExportStateCache::ReadStateJson(const FString& FilePath)
+{
+	FString JsonString;
+	if (!FFileHelper::LoadFileToString(JsonString, *FilePath))
+	{
+		return nullptr;
+	}
+
+	TSharedPtr<FJsonObject> StateJson;
+	TSharedRef<TJsonReader<>> JsonReader = TJsonReaderFactory<>::Create(JsonString);
+	if (!FJsonSerializer::Deserialize(JsonReader, StateJson) || !StateJson.IsValid())
+	{
+		UE_LOG(LogUEMeshBPExport, Warning, TEXT("Export state file is corrupt, all assets will be exported again: %s"), *FilePath);
+		return nullptr;
+	}
+
+	int32 Version = 0;
+	if (!StateJson->TryGetNumberField(TEXT("Version"), Version) || Version != ExportStateVersion)
+	{
+		UE_LOG(LogUEMeshBPExport, Log, TEXT("Export state file has a different version, all assets will be exported again: %s"), *FilePath);
+		return nullptr;
+	}
+
+	return StateJson;
+}
+
+void FUEMeshExportStateCache::Load(const FString& InExportRoot)
+{
+	ExportRoot = InExportRoot;
+	StateFilePath = FPaths::Combine(ExportRoot, ExportStateFileName);
+	Entries.Reset();
+	ChangedKeys.Reset();
+	bDirty = false;
+
+	const TSharedPtr<FJsonObject> StateJson = ReadStateJson(StateFilePath);
+	const TSharedPtr<FJsonObject>* AssetsJson = nullptr;
+	if (!StateJson.IsValid() || !StateJson->TryGetObjectField(TEXT("Assets"), AssetsJson))
+	{
+		return;
+	}
+
+	ReadEntries(**AssetsJson);
+}
+
+void FUEMeshExportStateCache::ReadEntries(const FJsonObject& AssetsJson)
+{
+	Entries.Reserve(Entries.Num() + AssetsJson.Values.Num());
+	for (const TPair<FString, TSharedPtr<FJsonValue>>& AssetPair : AssetsJson.Values)
+	{
+		const TSharedPtr<FJsonObject>* EntryJson = nullptr;
+		if (!AssetPair.Value.IsValid() || !AssetPair.Value->TryGetObject(EntryJson))
+		{
+			continue;
+		}
+
+		FEntry Entry;
+		FString OptionsHashString;
+		FString OutputSizeString;
+		FString OutputTimestampString;
+		(*EntryJson)->TryGetStringField(TEXT("SourceHash"), Entry.SourceHash);
+		(*EntryJson)->TryGetStringField(TEXT("OptionsHash"), OptionsHashString);
+		(*EntryJson)->TryGetStringField(TEXT("Output"), Entry.OutputPath);
+		(*EntryJson)->TryGetStringField(TEXT("OutputSize"), OutputSizeString);
+		(*EntryJson)->TryGetStringField(TEXT("OutputTimestamp"), OutputTimestampString);
+		(*EntryJson)->TryGetStringField(TEXT("OutputHash"), Entry.OutputHash);
+		(*EntryJson)->TryGetStringField(TEXT("SharedFrom"), Entry.SharedFrom);
+
+		LexFromString(Entry.OptionsHash, *OptionsHashString);
+		LexFromString(Entry.OutputSize, *OutputSizeString);
+		// Stored as ticks, ISO 8601 would truncate the sub-millisecond part of the file timestamp
+		int64 OutputTimestampTicks = 0;
+		LexFromString(OutputTimestampTicks, *OutputTimestampString);
+		Entry.OutputTimestamp = FDateTime(OutputTimestampTicks);
+
+		Entries.Add(AssetPair.Key, MoveTemp(Entry));
+	}
+}
+
+template <typename JsonWriterType>
+void FUEMeshExportStateCache::WriteEntry(JsonWriterType& JsonWriter, const FString& AssetKey, const FEntry& Entry)
+{
+	JsonWriter.WriteObjectStart(AssetKey);
+	JsonWriter.WriteValue(TEXT("SourceHash"), Entry.SourceHash);
+	JsonWriter.WriteValue(TEXT("OptionsHash"), LexToString(Entry.OptionsHash));
+	JsonWriter.WriteValue(TEXT("Output"), Entry.OutputPath);
+	JsonWriter.WriteValue(TEXT("OutputSize"), LexToString(Entry.OutputSize));
+	JsonWriter.WriteValue(TEXT("OutputTimestamp"), LexToString(Entry.OutputTimestamp.GetTicks()));
+	if (!Entry.OutputHash.IsEmpty())
+	{
+		JsonWriter.WriteValue(TEXT("OutputHash"), Entry.OutputHash);
+	}
+	if (!Entry.SharedFrom.IsEmpty())
+	{
+		JsonWriter.WriteValue(TEXT("SharedFrom"), Entry.SharedFrom);
+	}
+	JsonWriter.WriteObjectEnd();
+}
+
+bool FUEMeshExportStateCache::Save()
+{
+	if (!bDirty || StateFilePath.IsEmpty())
+	{
+		return true;
+	}
+
+	// Streamed, the state file holds one entry per asset ever exported into this root
+	const bool bSaved = WriteJsonFile(StateFilePath, false, [this](auto& JsonWriter)
+	{
+		JsonWriter.WriteObjectStart();
+		JsonWriter.WriteValue(TEXT("Version"), ExportStateVersion);
+
+		JsonWriter.WriteObjectStart(TEXT("Assets"));
+		for (const TPair<FString, FEntry>& EntryPair : Entries)
+		{
+			WriteEntry(JsonWriter, EntryPair.Key, EntryPair.Value);
+		}
+		JsonWriter.WriteObjectEnd();
+
+		JsonWriter.WriteObjectEnd();
+	});
+
+	if (!bSaved)
+	{
+		UE_LOG(LogUEMeshBPExport, Error, TEXT("Failed to save export state file: %s"), *StateFilePath);
+		return false;
+	}
+
+	bDirty = false;
+	return true;
+}
+
+bool FUEMeshExportStateCache::SaveChanges(const FString& FilePath) const
+{
+	const bool bSaved = WriteJsonFile(FilePath, true, [this](auto& JsonWriter)
+	{
+		JsonWriter.WriteObjectStart();
+		JsonWriter.WriteValue(TEXT("Version"), ExportStateVersion);
+
+		JsonWriter.WriteObjectStart(TEXT("Assets"));
+		for (const FString& AssetKey : ChangedKeys)
+		{
+			if (const FEntry* Entry = Entries.Find(AssetKey))
+			{
+				WriteEntry(JsonWriter, AssetKey, *Entry);
+			}
+		}
+		JsonWriter.WriteObjectEnd();
+
+		JsonWriter.WriteArrayStart(TEXT("Removed"));
+		for (const FString& AssetKey : ChangedKeys)
+		{
+			if (!Entries.Contains(AssetKey))
+			{
+				JsonWriter.WriteValue(AssetKey);
+			}
+		}
+		JsonWriter.WriteArrayEnd();
+
+		JsonWriter.WriteObjectEnd();
+	});
+
+	if (!bSaved)
+	{
+		UE_LOG(LogUEMeshBPExport, Error, TEXT("Failed to save export state changes: %s"), *FilePath);
+	}
+	return bSaved;
+}
+
+bool FUEMeshExportStateCache::MergeChanges(const FString& FilePath)
+{
+	const TSharedPtr<FJsonObject> ChangesJson = ReadStateJson(FilePath);
+	if (!ChangesJson.IsValid())
+	{
+		return false;
+	}
+
+	const TArray<TSharedPtr<FJsonValue>>* RemovedJson = nullptr;
+	if (ChangesJson->TryGetArrayField(TEXT("Removed"), RemovedJson))
+	{
+		for (const TSharedPtr<FJsonValue>& RemovedValue : *RemovedJson)
+		{
+			Invalidate(RemovedValue->AsString());
+		}
+	}
+
+	const TSharedPtr<FJsonObject>* AssetsJson = nullptr;
+	if (ChangesJson->TryGetObjectField(TEXT("Assets"), AssetsJson))
+	{
+		ReadEntries(**AssetsJson);
+		for (const TPair<FString, TSharedPtr<FJsonValue>>& AssetPair : (*AssetsJson)->Values)
+		{
+			ChangedKeys.Add(AssetPair.Key);
+		}
+		bDirty = true;
+	}
+	return true;
+}
+
+FString FUEMeshExportStateCache::ComputeSourceHash(const UObject* Asset)
+{
+	FString SourceHash = GetSavedPackageHash(Asset);
+	if (SourceHash.IsEmpty())
+	{
+		return FString();
+	}
+
+	if (const UTexture* Texture = Cast<UTexture>(Asset))
+	{
+		// The source id changes whenever the texture is reimported or its source is edited
+		SourceHash += TEXT("-") + Texture->Source.GetId().ToString();
+	}
+	else if (const UMaterialInstance* MaterialInstance = Cast<UMaterialInstance>(Asset))
+	{
+		// Parameters not overridden by the instance come from its parents
+		for (const UMaterialInterface* Parent = MaterialInstance->Parent; Parent; )
+		{
+			const FString ParentHash = GetSavedPackageHash(Parent);
+			if (ParentHash.IsEmpty())
+			{
+				return FString();
+			}
+			SourceHash += TEXT("-") + ParentHash;
+
+			const UMaterialInstance* ParentInstance = Cast<UMaterialInstance>(Parent);
+			Parent = ParentInstance ? ParentInstance->Parent.Get() : nullptr;
+		}
+	}
+	else if (const UAnimSequence* Animation = Cast<UAnimSequence>(Asset))
+	{
+		// Tracks are written against the bone indices of the skeleton
+		const FString SkeletonHash = GetSavedPackageHash(Animation->GetSkeleton());
+		if (SkeletonHash.IsEmpty())
+		{
+			return FString();
+		}
+		SourceHash += TEXT("-") + SkeletonHash;
+	}
+
+	return SourceHash;
+}
+
+bool FUEMeshExportStateCache::IsUpToDate(const FString& AssetKey, const FString& SourceHash, uint32 OptionsHash, const FString& OutputPath)
+{
+	if (SourceHash.IsEmpty())
+	{
+		return false;
+	}
+
+	FEntry* Entry = Entries.Find(AssetKey);
+	if (!Entry || Entry->SourceHash != SourceHash || Entry->OptionsHash != OptionsHash || Entry->OutputPath != OutputPath)
+	{
+		return false;
+	}
+
+	// A single stat call tells whether the output was deleted or modified since it was written
+	const FString FullOutputPath = FPaths::Combine(ExportRoot, OutputPath);
+	const FFileStatData StatData = FPlatformFileManager::Get().GetPlatformFile().GetStatData(*FullOutputPath);
+	if (!StatData.bIsValid || StatData.FileSize != Entry->OutputSize)
+	{
+		return false;
+	}
+	if (StatData.ModificationTime == Entry->OutputTimestamp)
+	{
+		return true;
+	}
+
+	// Copied or restored outputs keep their content but not their timestamp, the hash tells them apart from edited ones
+	if (Entry->OutputHash.IsEmpty() || LexToString(FMD5Hash::HashFile(*FullOutputPath)) != Entry->OutputHash)
+	{
+		return false;
+	}
+	Entry->OutputTimestamp = StatData.ModificationTime;
+	ChangedKeys.Add(AssetKey);
+	bDirty = true;
+	return true;
+}
+
+void FUEMeshExportStateCache::Record(const FString& AssetKey, const FString& SourceHash, uint32 OptionsHash, const FString& OutputPath, const FString& OutputHash)
+{
+	const FString FullOutputPath = FPaths::Combine(ExportRoot, OutputPath);
+	const FFileStatData StatData = FPlatformFileManager::Get().GetPlatformFile().GetStatData(*FullOutputPath);
+	if (SourceHash.IsEmpty() || !StatData.bIsValid)
+	{
+		Invalidate(AssetKey);
+		return;
+	}
+
+	FEntry& Entry = Entries.FindOrAdd(AssetKey);
+	Entry.SourceHash = SourceHash;
+	Entry.OptionsHash = OptionsHash;
+	Entry.OutputPath = OutputPath;
+	Entry.OutputSize = StatData.FileSize;
+	Entry.OutputTimestamp = StatData.ModificationTime;
+	Entry.OutputHash = OutputHash;
+	Entry.SharedFrom.Reset();
+	ChangedKeys.Add(AssetKey);
+	bDirty = true;
+}
+
+void FUEMeshExportStateCache::RecordShared(const FString& AssetKey, const FString& SourceHash, uint32 OptionsHash, const FString& OwnerKey)
+{
+	const FEntry* OwnerEntry = Entries.Find(OwnerKey);
+	if (SourceHash.IsEmpty() || !OwnerEntry)
+	{
+		Invalidate(AssetKey);
+		return;
+	}
+
+	// The file was just recorded for the owner, its size, time and hash are reused as they are
+	FEntry Entry = *OwnerEntry;
+	Entry.SourceHash = SourceHash;
+	Entry.OptionsHash = OptionsHash;
+	Entry.SharedFrom = OwnerKey;
+	Entries.Add(AssetKey, MoveTemp(Entry));
+	ChangedKeys.Add(AssetKey);
+	bDirty = true;
+}
+
+bool FUEMeshExportStateCache::FindOutput(const FString& AssetKey, FString& OutOutputPath, FString& OutSharedFrom) const
+{
+	const FEntry* Entry = Entries.Find(AssetKey);
+	if (!Entry)
+	{
+		return false;
+	}
+
+	OutOutputPath = Entry->OutputPath;
+	OutSharedFrom = Entry->SharedFrom;
+	return true;
+}
+
+void FUEMeshExportStateCache::Invalidate(const FString& AssetKey)
+{
+	if (Entries.Remove(AssetKey) > 0)
+	{
+		ChangedKeys.Add(AssetKey);
+		bDirty = true;
+	}
+}
+#endif
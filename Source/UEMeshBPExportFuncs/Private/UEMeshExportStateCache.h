@@ -0,0 +1,93 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#if WITH_EDITOR
+class FJsonObject;
+
+/*
+*	Persistent record of what previous exports wrote into an export root, stored as <ExportRoot>/.uemeshexport_state.json.
+*	Each entry maps an asset key to the source hash of the asset, the hash of the options it was exported with and the
+*	size/timestamp of the file that was written. An asset is exported again only if one of them changed. Outputs recorded
+*	with a content hash survive a changed timestamp as long as their content still matches it.
+*/
+class FUEMeshExportStateCache
+{
+public:
+	/** Reads the state file of ExportRoot. A missing or unreadable file starts an empty cache. */
+	void Load(const FString& InExportRoot);
+
+	/** Writes the state file if anything changed since Load */
+	bool Save();
+
+	/**
+	 * Writes only the entries recorded or invalidated since Load into FilePath, instead of the whole state file.
+	 * Used by export workers that share an export root, the coordinator applies the files with MergeChanges.
+	 */
+	bool SaveChanges(const FString& FilePath) const;
+
+	/** Applies a file written by SaveChanges, the state file is written by the next Save */
+	bool MergeChanges(const FString& FilePath);
+
+	/**
+	 * Hash identifying the saved state of an asset and of everything its export depends on.
+	 * Returns an empty string if the asset has unsaved changes or was never saved, such assets are always exported.
+	 */
+	static FString ComputeSourceHash(const UObject* Asset);
+
+	/**
+	 * True if OutputPath was written from the same source and options and has not been touched since.
+	 * A file with a new timestamp but the recorded size and hash is still current, its entry takes the new timestamp.
+	 */
+	bool IsUpToDate(const FString& AssetKey, const FString& SourceHash, uint32 OptionsHash, const FString& OutputPath);
+
+	/**
+	 * Remembers a successful export. OutputHash is the MD5 of the file if the writer computed it while writing, outputs
+	 * without one are validated by size and timestamp only, hashing them afterwards would read every file a second time.
+	 */
+	void Record(const FString& AssetKey, const FString& SourceHash, uint32 OptionsHash, const FString& OutputPath, const FString& OutputHash = FString());
+
+	/**
+	 * Remembers an asset whose output is the file already recorded for OwnerKey, because both had the same content.
+	 * Forgets the asset instead if OwnerKey has no entry.
+	 */
+	void RecordShared(const FString& AssetKey, const FString& SourceHash, uint32 OptionsHash, const FString& OwnerKey);
+
+	/** Output path recorded for an asset and the key of the asset it shares that file with, empty if it owns it. False without an entry. */
+	bool FindOutput(const FString& AssetKey, FString& OutOutputPath, FString& OutSharedFrom) const;
+
+	/** Forgets an asset, e.g. after its export failed */
+	void Invalidate(const FString& AssetKey);
+
+private:
+	struct FEntry
+	{
+		FString SourceHash;
+		uint32 OptionsHash = 0;
+		FString OutputPath;
+		int64 OutputSize = -1;
+		FDateTime OutputTimestamp;
+		FString OutputHash;
+		/** Asset that wrote OutputPath, set for entries recorded with RecordShared */
+		FString SharedFrom;
+	};
+
+	/** Reads a version checked state or changes file, null if it is missing or unusable */
+	static TSharedPtr<FJsonObject> ReadStateJson(const FString& FilePath);
+
+	/** Adds the entries of an "Assets" object, replacing existing ones */
+	void ReadEntries(const FJsonObject& AssetsJson);
+
+	template <typename JsonWriterType>
+	static void WriteEntry(JsonWriterType& JsonWriter, const FString& AssetKey, const FEntry& Entry);
+
+	FString ExportRoot;
+	FString StateFilePath;
+	TMap<FString, FEntry> Entries;
+	/** Keys recorded or invalidated since Load, see SaveChanges */
+	TSet<FString> ChangedKeys;
+	bool bDirty = false;
+};
+#endif
@@ -0,0 +1,793 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "UEMeshGlbWriter.h"
+#include "UEMeshBPExportFuncs.h"
+#include "UEMeshBPExportFuncsStats.h"
+
+#if WITH_EDITOR
+#include "Engine/SkeletalMesh.h"
+#include "Engine/StaticMesh.h"
+#include "StaticMeshResources.h"
+#include "Rendering/SkeletalMeshRenderData.h"
+#include "Rendering/SkeletalMeshLODRenderData.h"
+#include "Animation/MorphTarget.h"
+#include "HAL/FileManager.h"
+#include "Serialization/MemoryWriter.h"
+#include "Serialization/JsonWriter.h"
+#include "Policies/CondensedJsonPrintPolicy.h"
+#include "Templates/UniquePtr.h"
+
+static constexpr uint32 GlbMagic = 0x46546C67; // "glTF"
+static constexpr uint32 GlbVersion = 2;
+static constexpr uint32 GlbJsonChunkType = 0x4E4F534A; // "JSON"
+static constexpr uint32 GlbBinChunkType = 0x004E4942; // "BIN\0"
+
+// glTF accessor component types and buffer view targets
+static constexpr int32 GltfUnsignedShort = 5123;
+static constexpr int32 GltfUnsignedInt = 5125;
+static constexpr int32 GltfFloat = 5126;
+static constexpr int32 GltfArrayBuffer = 34962;
+static constexpr int32 GltfElementArrayBuffer = 34963;
+
+static constexpr float CentimetersToMeters = 0.01f;
+
+// Everything the writer reads from the render data of one LOD, skeletal and static meshes alike
+struct FGlbMeshSource
+{
+	struct FSection
+	{
+		uint32 FirstIndex = 0;
+		uint32 NumTriangles = 0;
+		int32 MaterialIndex = INDEX_NONE;
+		// Skeletal meshes only, vertex range and bone map of the section
+		uint32 BaseVertexIndex = 0;
+		uint32 NumVertices = 0;
+		const TArray<FBoneIndexType>* BoneMap = nullptr;
+	};
+
+	struct FMorphTarget
+	{
+		FString Name;
+		const FMorphTargetDelta* Deltas = nullptr;
+		int32 NumDeltas = 0;
+	};
+
+	const FPositionVertexBuffer* Positions = nullptr;
+	const FStaticMeshVertexBuffer* VertexData = nullptr;
+	const void* IndexData = nullptr;
+	uint32 NumIndices = 0;
+	bool b32BitIndices = false;
+	TArray<FSection> Sections;
+	TArray<FName> MaterialSlotNames;
+
+	// Skeletal meshes only
+	const FSkinWeightVertexBuffer* SkinWeights = nullptr;
+	const FReferenceSkeleton* RefSkeleton = nullptr;
+	/** Deltas of the LOD, indexed by its render vertices */
+	TArray<FMorphTarget> MorphTargets;
+};
+
+// Binary chunk of the file, every buffer view starts 4-byte aligned as accessors require
+struct FGlbBinaryChunk
+{
+	struct FBufferView
+	{
+		int64 Offset = 0;
+		int64 Length = 0;
+		int32 Target = 0;
+	};
+
+	TArray64<uint8> Data;
+	TArray<FBufferView> Views;
+
+	// Adds a view of Length bytes and returns where to write it, the pointer is valid until the next AddView
+	uint8* AddView(int64 Length, int32 Target, int32& OutViewIndex)
+	{
+		const int64 Offset = Align(Data.Num(), 4);
+		Data.AddZeroed(Offset - Data.Num());
+		Data.AddUninitialized(Length);
+
+		OutViewIndex = Views.Add({ Offset, Length, Target });
+		return Data.GetData() + Offset;
+	}
+};
+
+struct FGlbAccessor
+{
+	/** INDEX_NONE for sparse accessors without a base view, every element not listed there is zero */
+	int32 BufferView = INDEX_NONE;
+	int64 ByteOffset = 0;
+	int32 ComponentType = GltfFloat;
+	int64 Count = 0;
+	const TCHAR* Type = TEXT("SCALAR");
+	bool bHasBounds = false;
+	FVector3f Min = FVector3f::ZeroVector;
+	FVector3f Max = FVector3f::ZeroVector;
+	// Sparse accessors only, SparseCount uint32 indices and the values at them
+	int64 SparseCount = 0;
+	int32 SparseIndicesView = INDEX_NONE;
+	int32 SparseValuesView = INDEX_NONE;
+};
+
+// Helper function: Unreal to glTF axes, Y and Z are swapped, which also turns the left-handed basis right-handed
+static FORCEINLINE void WriteConvertedVector(float* Out, float X, float Y, float Z)
+{
+	Out[0] = X;
+	Out[1] = Z;
+	Out[2] = Y;
+}
+
+// Helper function: Bone transform in glTF space. The axis swap is a reflection, so the rotation axis flips sign.
+static FTransform ConvertTransform(const FTransform& Transform)
+{
+	const FVector Location = Transform.GetLocation() * CentimetersToMeters;
+	const FQuat Rotation = Transform.GetRotation();
+	const FVector Scale = Transform.GetScale3D();
+	return FTransform(FQuat(-Rotation.X, -Rotation.Z, -Rotation.Y, Rotation.W), FVector(Location.X, Location.Z, Location.Y), FVector(Scale.X, Scale.Z, Scale.Y));
+}
+
+// Helper function: Read the buffers of one LOD of a static mesh
+static bool GetStaticMeshSource(UStaticMesh* StaticMesh, int32 LODIndex, FGlbMeshSource& OutSource)
+{
+	const FStaticMeshRenderData* RenderData = StaticMesh->GetRenderData();
+	if (!RenderData || !RenderData->LODResources.IsValidIndex(LODIndex))
+	{
+		return false;
+	}
+
+	const FStaticMeshLODResources& LOD = RenderData->LODResources[LODIndex];
+	OutSource.Positions = &LOD.VertexBuffers.PositionVertexBuffer;
+	OutSource.VertexData = &LOD.VertexBuffers.StaticMeshVertexBuffer;
+	OutSource.b32BitIndices = LOD.IndexBuffer.Is32Bit();
+	OutSource.IndexData = OutSource.b32BitIndices ? (const void*)LOD.IndexBuffer.AccessStream32() : (const void*)LOD.IndexBuffer.AccessStream16();
+	OutSource.NumIndices = LOD.IndexBuffer.GetNumIndices();
+
+	for (const FStaticMeshSection& Section : LOD.Sections)
+	{
+		FGlbMeshSource::FSection& OutSection = OutSource.Sections.AddDefaulted_GetRef();
+		OutSection.FirstIndex = Section.FirstIndex;
+		OutSection.NumTriangles = Section.NumTriangles;
+		OutSection.MaterialIndex = Section.MaterialIndex;
+	}
+
+	for (const FStaticMaterial& StaticMaterial : StaticMesh->GetStaticMaterials())
+	{
+		OutSource.MaterialSlotNames.Add(StaticMaterial.MaterialSlotName);
+	}
+	return true;
+}
+
+// Helper function: Read the buffers of one LOD, skin weights, reference skeleton and optionally morph targets of a skeletal mesh
+static bool GetSkeletalMeshSource(USkeletalMesh* SkeletalMesh, int32 LODIndex, bool bMorphTargets, FGlbMeshSource& OutSource)
+{
+	FSkeletalMeshRenderData* RenderData = SkeletalMesh->GetResourceForRendering();
+	if (!RenderData || !RenderData->LODRenderData.IsValidIndex(LODIndex))
+	{
+		return false;
+	}
+
+	FSkeletalMeshLODRenderData& LOD = RenderData->LODRenderData[LODIndex];
+	FRawStaticIndexBuffer16or32Interface* IndexBuffer = LOD.MultiSizeIndexContainer.GetIndexBuffer();
+	if (!IndexBuffer)
+	{
+		return false;
+	}
+
+	OutSource.Positions = &LOD.StaticVertexBuffers.PositionVertexBuffer;
+	OutSource.VertexData = &LOD.StaticVertexBuffers.StaticMeshVertexBuffer;
+	OutSource.b32BitIndices = LOD.MultiSizeIndexContainer.GetDataTypeSize() == sizeof(uint32);
+	OutSource.NumIndices = IndexBuffer->Num();
+	OutSource.IndexData = OutSource.NumIndices > 0 ? IndexBuffer->GetPointerTo(0) : nullptr;
+	OutSource.SkinWeights = &LOD.SkinWeightVertexBuffer;
+	OutSource.RefSkeleton = &SkeletalMesh->GetRefSkeleton();
+
+	for (const FSkelMeshRenderSection& Section : LOD.RenderSections)
+	{
+		FGlbMeshSource::FSection& OutSection = OutSource.Sections.AddDefaulted_GetRef();
+		OutSection.FirstIndex = Section.BaseIndex;
+		OutSection.NumTriangles = Section.NumTriangles;
+		OutSection.MaterialIndex = Section.MaterialIndex;
+		OutSection.BaseVertexIndex = Section.BaseVertexIndex;
+		OutSection.NumVertices = Section.NumVertices;
+		OutSection.BoneMap = &Section.BoneMap;
+	}
+
+	for (const FSkeletalMaterial& SkeletalMaterial : SkeletalMesh->GetMaterials())
+	{
+		OutSource.MaterialSlotNames.Add(SkeletalMaterial.MaterialSlotName);
+	}
+
+	// Every LOD file lists the same targets in the same order, those without deltas in this LOD stay empty
+	if (bMorphTargets)
+	{
+		for (UMorphTarget* MorphTarget : SkeletalMesh->GetMorphTargets())
+		{
+			if (!MorphTarget)
+			{
+				continue;
+			}
+
+			FGlbMeshSource::FMorphTarget& OutMorphTarget = OutSource.MorphTargets.AddDefaulted_GetRef();
+			OutMorphTarget.Name = MorphTarget->GetName();
+			OutMorphTarget.Deltas = MorphTarget->GetMorphTargetDelta(LODIndex, OutMorphTarget.NumDeltas);
+			if (!OutMorphTarget.Deltas)
+			{
+				OutMorphTarget.NumDeltas = 0;
+			}
+		}
+	}
+	return true;
+}
+
+// Helper function: Write the vertex streams, indices and skin of the source into the binary chunk
+static void WriteMeshBuffers(const FGlbMeshSource& Source, FGlbBinaryChunk& Chunk, TArray<FGlbAccessor>& OutAccessors, TMap<FString, int32>& OutAttributes, TArray<int32>& OutSectionAccessors, int32& OutInverseBindAccessor, TArray<TPair<int32, int32>>& OutMorphTargetAccessors)
+{
+	const uint32 NumVertices = Source.Positions->GetNumVertices();
+	const uint32 NumTexCoords = Source.VertexData->GetNumTexCoords();
+	const int32 NumBones = Source.RefSkeleton ? Source.RefSkeleton->GetRawBoneNum() : 0;
+
+	int64 NumMorphDeltas = 0;
+	for (const FGlbMeshSource::FMorphTarget& MorphTarget : Source.MorphTargets)
+	{
+		NumMorphDeltas += MorphTarget.NumDeltas;
+	}
+
+	// One allocation for the whole chunk, views are padded to 4 bytes at most
+	Chunk.Data.Reserve((int64)NumVertices * (3 + 3 + 4 + (NumTexCoords > 0 ? 2 : 0)) * sizeof(float)
+		+ (Source.SkinWeights ? (int64)NumVertices * (4 * sizeof(uint16) + 4 * sizeof(float)) : 0)
+		+ (int64)Source.NumIndices * (Source.b32BitIndices ? sizeof(uint32) : sizeof(uint16))
+		+ (int64)NumBones * 16 * sizeof(float)
+		+ NumMorphDeltas * (sizeof(uint32) + 2 * 3 * sizeof(float)) + (8 + 3 * Source.MorphTargets.Num()) * 4);
+
+	auto AddVertexAccessor = [&](const TCHAR* Attribute, int32 ComponentType, const TCHAR* Type, int32 View)
+	{
+		FGlbAccessor& Accessor = OutAccessors.AddDefaulted_GetRef();
+		Accessor.BufferView = View;
+		Accessor.ComponentType = ComponentType;
+		Accessor.Count = NumVertices;
+		Accessor.Type = Type;
+		OutAttributes.Add(Attribute, OutAccessors.Num() - 1);
+		return OutAccessors.Num() - 1;
+	};
+
+	int32 View = INDEX_NONE;
+
+	// Positions, with the bounds glTF requires for them
+	{
+		float* Out = reinterpret_cast<float*>(Chunk.AddView((int64)NumVertices * 3 * sizeof(float), GltfArrayBuffer, View));
+		FGlbAccessor& Accessor = OutAccessors[AddVertexAccessor(TEXT("POSITION"), GltfFloat, TEXT("VEC3"), View)];
+		Accessor.bHasBounds = NumVertices > 0;
+		Accessor.Min = FVector3f(MAX_flt);
+		Accessor.Max = FVector3f(-MAX_flt);
+		for (uint32 VertexIndex = 0; VertexIndex < NumVertices; VertexIndex++, Out += 3)
+		{
+			const FVector3f Position = Source.Positions->VertexPosition(VertexIndex) * CentimetersToMeters;
+			WriteConvertedVector(Out, Position.X, Position.Y, Position.Z);
+			Accessor.Min = FVector3f::Min(Accessor.Min, FVector3f(Out[0], Out[1], Out[2]));
+			Accessor.Max = FVector3f::Max(Accessor.Max, FVector3f(Out[0], Out[1], Out[2]));
+		}
+	}
+
+	// Normals
+	{
+		float* Out = reinterpret_cast<float*>(Chunk.AddView((int64)NumVertices * 3 * sizeof(float), GltfArrayBuffer, View));
+		AddVertexAccessor(TEXT("NORMAL"), GltfFloat, TEXT("VEC3"), View);
+		for (uint32 VertexIndex = 0; VertexIndex < NumVertices; VertexIndex++, Out += 3)
+		{
+			const FVector3f Normal = FVector3f(Source.VertexData->VertexTangentZ(VertexIndex)).GetSafeNormal(UE_SMALL_NUMBER, FVector3f::UpVector);
+			WriteConvertedVector(Out, Normal.X, Normal.Y, Normal.Z);
+		}
+	}
+
+	// Tangents, the reflection flips the handedness of the bitangent as well
+	{
+		float* Out = reinterpret_cast<float*>(Chunk.AddView((int64)NumVertices * 4 * sizeof(float), GltfArrayBuffer, View));
+		AddVertexAccessor(TEXT("TANGENT"), GltfFloat, TEXT("VEC4"), View);
+		for (uint32 VertexIndex = 0; VertexIndex < NumVertices; VertexIndex++, Out += 4)
+		{
+			const FVector3f Tangent = FVector3f(Source.VertexData->VertexTangentX(VertexIndex)).GetSafeNormal(UE_SMALL_NUMBER, FVector3f::ForwardVector);
+			WriteConvertedVector(Out, Tangent.X, Tangent.Y, Tangent.Z);
+			Out[3] = Source.VertexData->VertexTangentZ(VertexIndex).W < 0.0f ? 1.0f : -1.0f;
+		}
+	}
+
+	// First UV channel, glTF and Unreal share the top-left origin
+	if (NumTexCoords > 0)
+	{
+		float* Out = reinterpret_cast<float*>(Chunk.AddView((int64)NumVertices * 2 * sizeof(float), GltfArrayBuffer, View));
+		AddVertexAccessor(TEXT("TEXCOORD_0"), GltfFloat, TEXT("VEC2"), View);
+		for (uint32 VertexIndex = 0; VertexIndex < NumVertices; VertexIndex++, Out += 2)
+		{
+			const FVector2f UV = Source.VertexData->GetVertexUV(VertexIndex, 0);
+			Out[0] = UV.X;
+			Out[1] = UV.Y;
+		}
+	}
+
+	// Four strongest influences per vertex, bone indices are mapped from the section bone map to skeleton bones
+	if (Source.SkinWeights && Source.SkinWeights->GetNumVertices() == NumVertices)
+	{
+		const uint32 NumInfluences = FMath::Min<uint32>(Source.SkinWeights->GetMaxBoneInfluences(), 4);
+
+		int32 JointsView = INDEX_NONE;
+		uint16* OutJoints = reinterpret_cast<uint16*>(Chunk.AddView((int64)NumVertices * 4 * sizeof(uint16), GltfArrayBuffer, JointsView));
+		FMemory::Memzero(OutJoints, (int64)NumVertices * 4 * sizeof(uint16));
+		for (const FGlbMeshSource::FSection& Section : Source.Sections)
+		{
+			for (uint32 VertexIndex = Section.BaseVertexIndex; VertexIndex < Section.BaseVertexIndex + Section.NumVertices && VertexIndex < NumVertices; VertexIndex++)
+			{
+				for (uint32 Influence = 0; Influence < NumInfluences; Influence++)
+				{
+					const uint32 LocalBone = Source.SkinWeights->GetBoneIndex(VertexIndex, Influence);
+					OutJoints[VertexIndex * 4 + Influence] = Section.BoneMap->IsValidIndex(LocalBone) ? (*Section.BoneMap)[LocalBone] : 0;
+				}
+			}
+		}
+
+		int32 WeightsView = INDEX_NONE;
+		float* OutWeights = reinterpret_cast<float*>(Chunk.AddView((int64)NumVertices * 4 * sizeof(float), GltfArrayBuffer, WeightsView));
+		for (uint32 VertexIndex = 0; VertexIndex < NumVertices; VertexIndex++, OutWeights += 4)
+		{
+			float Sum = 0.0f;
+			for (uint32 Influence = 0; Influence < 4; Influence++)
+			{
+				OutWeights[Influence] = Influence < NumInfluences ? (float)Source.SkinWeights->GetBoneWeight(VertexIndex, Influence) : 0.0f;
+				Sum += OutWeights[Influence];
+			}
+
+			// Weights are stored in 8 or 16 bit depending on the engine version, normalizing covers both
+			for (uint32 Influence = 0; Influence < 4; Influence++)
+			{
+				OutWeights[Influence] = Sum > 0.0f ? OutWeights[Influence] / Sum : (Influence == 0 ? 1.0f : 0.0f);
+			}
+		}
+
+		// The joints view was written before the weights view was added, AddView may have moved the data since
+		AddVertexAccessor(TEXT("JOINTS_0"), GltfUnsignedShort, TEXT("VEC4"), JointsView);
+		AddVertexAccessor(TEXT("WEIGHTS_0"), GltfFloat, TEXT("VEC4"), WeightsView);
+	}
+
+	// Morph targets are sparse, position and normal deltas share the sorted vertex indices of their target.
+	// The indices view is written before the values views are added, AddView may move the data.
+	for (const FGlbMeshSource::FMorphTarget& MorphTarget : Source.MorphTargets)
+	{
+		TArray<int32> DeltaOrder;
+		DeltaOrder.Reserve(MorphTarget.NumDeltas);
+		for (int32 DeltaIndex = 0; DeltaIndex < MorphTarget.NumDeltas; DeltaIndex++)
+		{
+			if (MorphTarget.Deltas[DeltaIndex].SourceIdx < NumVertices)
+			{
+				DeltaOrder.Add(DeltaIndex);
+			}
+		}
+		DeltaOrder.Sort([&MorphTarget](int32 A, int32 B) { return MorphTarget.Deltas[A].SourceIdx < MorphTarget.Deltas[B].SourceIdx; });
+
+		// glTF wants strictly increasing indices, a vertex listed twice keeps its first delta
+		int32 NumUnique = 0;
+		for (int32 OrderIndex = 0; OrderIndex < DeltaOrder.Num(); OrderIndex++)
+		{
+			if (NumUnique == 0 || MorphTarget.Deltas[DeltaOrder[OrderIndex]].SourceIdx != MorphTarget.Deltas[DeltaOrder[NumUnique - 1]].SourceIdx)
+			{
+				DeltaOrder[NumUnique++] = DeltaOrder[OrderIndex];
+			}
+		}
+		DeltaOrder.SetNum(NumUnique);
+
+		FGlbAccessor PositionAccessor;
+		PositionAccessor.Count = NumVertices;
+		PositionAccessor.Type = TEXT("VEC3");
+		PositionAccessor.bHasBounds = true;
+		FGlbAccessor NormalAccessor = PositionAccessor;
+		NormalAccessor.bHasBounds = false;
+
+		if (NumUnique > 0)
+		{
+			int32 IndicesView = INDEX_NONE;
+			uint32* OutIndices = reinterpret_cast<uint32*>(Chunk.AddView((int64)NumUnique * sizeof(uint32), 0, IndicesView));
+			for (int32 DeltaIndex : DeltaOrder)
+			{
+				*OutIndices++ = MorphTarget.Deltas[DeltaIndex].SourceIdx;
+			}
+
+			// Vertices without a delta are zero, which the bounds have to include unless every vertex has one
+			PositionAccessor.Min = NumUnique < (int32)NumVertices ? FVector3f::ZeroVector : FVector3f(MAX_flt);
+			PositionAccessor.Max = NumUnique < (int32)NumVertices ? FVector3f::ZeroVector : FVector3f(-MAX_flt);
+
+			int32 PositionsView = INDEX_NONE;
+			float* OutPositions = reinterpret_cast<float*>(Chunk.AddView((int64)NumUnique * 3 * sizeof(float), 0, PositionsView));
+			for (int32 DeltaIndex : DeltaOrder)
+			{
+				const FVector3f PositionDelta = FVector3f(MorphTarget.Deltas[DeltaIndex].PositionDelta) * CentimetersToMeters;
+				WriteConvertedVector(OutPositions, PositionDelta.X, PositionDelta.Y, PositionDelta.Z);
+				PositionAccessor.Min = FVector3f::Min(PositionAccessor.Min, FVector3f(OutPositions[0], OutPositions[1], OutPositions[2]));
+				PositionAccessor.Max = FVector3f::Max(PositionAccessor.Max, FVector3f(OutPositions[0], OutPositions[1], OutPositions[2]));
+				OutPositions += 3;
+			}
+
+			int32 NormalsView = INDEX_NONE;
+			float* OutNormals = reinterpret_cast<float*>(Chunk.AddView((int64)NumUnique * 3 * sizeof(float), 0, NormalsView));
+			for (int32 DeltaIndex : DeltaOrder)
+			{
+				const FVector3f NormalDelta = FVector3f(MorphTarget.Deltas[DeltaIndex].TangentZDelta);
+				WriteConvertedVector(OutNormals, NormalDelta.X, NormalDelta.Y, NormalDelta.Z);
+				OutNormals += 3;
+			}
+
+			PositionAccessor.SparseCount = NumUnique;
+			PositionAccessor.SparseIndicesView = IndicesView;
+			PositionAccessor.SparseValuesView = PositionsView;
+			NormalAccessor.SparseCount = NumUnique;
+			NormalAccessor.SparseIndicesView = IndicesView;
+			NormalAccessor.SparseValuesView = NormalsView;
+		}
+
+		const int32 PositionAccessorIndex = OutAccessors.Add(PositionAccessor);
+		const int32 NormalAccessorIndex = OutAccessors.Add(NormalAccessor);
+		OutMorphTargetAccessors.Emplace(PositionAccessorIndex, NormalAccessorIndex);
+	}
+
+	// Indices are copied as they are, every section becomes an accessor into the same view
+	{
+		const int32 IndexSize = Source.b32BitIndices ? sizeof(uint32) : sizeof(uint16);
+		uint8* Out = Chunk.AddView((int64)Source.NumIndices * IndexSize, GltfElementArrayBuffer, View);
+		if (Source.NumIndices > 0)
+		{
+			FMemory::Memcpy(Out, Source.IndexData, (int64)Source.NumIndices * IndexSize);
+		}
+
+		for (const FGlbMeshSource::FSection& Section : Source.Sections)
+		{
+			FGlbAccessor& Accessor = OutAccessors.AddDefaulted_GetRef();
+			Accessor.BufferView = View;
+			Accessor.ByteOffset = (int64)Section.FirstIndex * IndexSize;
+			Accessor.ComponentType = Source.b32BitIndices ? GltfUnsignedInt : GltfUnsignedShort;
+			Accessor.Count = (int64)Section.NumTriangles * 3;
+			OutSectionAccessors.Add(OutAccessors.Num() - 1);
+		}
+	}
+
+	// Inverse bind matrices, column-major. FMatrix is row-vector, so its row-major memory is already the column-major transpose.
+	OutInverseBindAccessor = INDEX_NONE;
+	if (NumBones > 0)
+	{
+		float* Out = reinterpret_cast<float*>(Chunk.AddView((int64)NumBones * 16 * sizeof(float), 0, View));
+
+		const TArray<FTransform>& RefPose = Source.RefSkeleton->GetRawRefBonePose();
+		TArray<FTransform> GlobalTransforms;
+		GlobalTransforms.SetNum(NumBones);
+		for (int32 BoneIndex = 0; BoneIndex < NumBones; BoneIndex++)
+		{
+			const int32 ParentIndex = Source.RefSkeleton->GetRawParentIndex(BoneIndex);
+			const FTransform LocalTransform = ConvertTransform(RefPose[BoneIndex]);
+			GlobalTransforms[BoneIndex] = ParentIndex != INDEX_NONE ? LocalTransform * GlobalTransforms[ParentIndex] : LocalTransform;
+
+			const FMatrix InverseBind = GlobalTransforms[BoneIndex].ToMatrixWithScale().Inverse();
+			for (int32 Row = 0; Row < 4; Row++)
+			{
+				for (int32 Column = 0; Column < 4; Column++)
+				{
+					*Out++ = (float)InverseBind.M[Row][Column];
+				}
+			}
+		}
+
+		FGlbAccessor& Accessor = OutAccessors.AddDefaulted_GetRef();
+		Accessor.BufferView = View;
+		Accessor.Count = NumBones;
+		Accessor.Type = TEXT("MAT4");
+		OutInverseBindAccessor = OutAccessors.Num() - 1;
+	}
+}
+
+bool ExportMeshToGlb(UStreamableRenderAsset* Mesh, const FString& OutputPath, int32 LODIndex, bool bMorphTargets)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UEMeshBPExport_ExportMeshToGlb);
+
+	if (!Mesh || OutputPath.IsEmpty())
+	{
+		return false;
+	}
+
+	FGlbMeshSource Source;
+	bool bHasSource = false;
+	if (USkeletalMesh* SkeletalMesh = Cast<USkeletalMesh>(Mesh))
+	{
+		bHasSource = GetSkeletalMeshSource(SkeletalMesh, LODIndex, bMorphTargets, Source);
+	}
+	else if (UStaticMesh* StaticMesh = Cast<UStaticMesh>(Mesh))
+	{
+		bHasSource = GetStaticMeshSource(StaticMesh, LODIndex, Source);
+	}
+
+	// Render data without CPU copies (e.g. cooked without CPU access) cannot be read back
+	if (!bHasSource || Source.Positions->GetNumVertices() == 0 || !Source.Positions->GetVertexData() || !Source.VertexData->GetTangentData()
+		|| (Source.NumIndices > 0 && !Source.IndexData))
+	{
+		UE_LOG(LogUEMeshBPExport, Error, TEXT("Failed to export mesh: %s has no readable render data for LOD %d"), *Mesh->GetName(), LODIndex);
+		return false;
+	}
+
+	FGlbBinaryChunk BinaryChunk;
+	TArray<FGlbAccessor> Accessors;
+	TMap<FString, int32> Attributes;
+	TArray<int32> SectionAccessors;
+	int32 InverseBindAccessor = INDEX_NONE;
+	TArray<TPair<int32, int32>> MorphTargetAccessors;
+	WriteMeshBuffers(Source, BinaryChunk, Accessors, Attributes, SectionAccessors, InverseBindAccessor, MorphTargetAccessors);
+
+	const int32 NumBones = InverseBindAccessor != INDEX_NONE ? Source.RefSkeleton->GetRawBoneNum() : 0;
+
+	// Node 0 holds the mesh, nodes 1..NumBones are the bones in skeleton order
+	TArray<uint8> JsonData;
+	FMemoryWriter JsonArchive(JsonData);
+	TSharedRef<TJsonWriter<UTF8CHAR, TCondensedJsonPrintPolicy<UTF8CHAR>>> JsonWriter = TJsonWriterFactory<UTF8CHAR, TCondensedJsonPrintPolicy<UTF8CHAR>>::Create(&JsonArchive);
+	JsonWriter->WriteObjectStart();
+
+	JsonWriter->WriteObjectStart(TEXT("asset"));
+	JsonWriter->WriteValue(TEXT("version"), TEXT("2.0"));
+	JsonWriter->WriteValue(TEXT("generator"), TEXT("UEMeshBPExportFuncs"));
+	JsonWriter->WriteObjectEnd();
+
+	JsonWriter->WriteValue(TEXT("scene"), 0);
+	JsonWriter->WriteArrayStart(TEXT("scenes"));
+	JsonWriter->WriteObjectStart();
+	JsonWriter->WriteArrayStart(TEXT("nodes"));
+	JsonWriter->WriteValue(0);
+	for (int32 BoneIndex = 0; BoneIndex < NumBones; BoneIndex++)
+	{
+		if (Source.RefSkeleton->GetRawParentIndex(BoneIndex) == INDEX_NONE)
+		{
+			JsonWriter->WriteValue(BoneIndex + 1);
+		}
+	}
+	JsonWriter->WriteArrayEnd();
+	JsonWriter->WriteObjectEnd();
+	JsonWriter->WriteArrayEnd();
+
+	JsonWriter->WriteArrayStart(TEXT("nodes"));
+	JsonWriter->WriteObjectStart();
+	JsonWriter->WriteValue(TEXT("name"), Mesh->GetName());
+	JsonWriter->WriteValue(TEXT("mesh"), 0);
+	if (NumBones > 0)
+	{
+		JsonWriter->WriteValue(TEXT("skin"), 0);
+	}
+	JsonWriter->WriteObjectEnd();
+	for (int32 BoneIndex = 0; BoneIndex < NumBones; BoneIndex++)
+	{
+		const FTransform BoneTransform = ConvertTransform(Source.RefSkeleton->GetRawRefBonePose()[BoneIndex]);
+		const FVector Translation = BoneTransform.GetLocation();
+		const FQuat Rotation = BoneTransform.GetRotation();
+		const FVector Scale = BoneTransform.GetScale3D();
+
+		JsonWriter->WriteObjectStart();
+		JsonWriter->WriteValue(TEXT("name"), Source.RefSkeleton->GetBoneName(BoneIndex).ToString());
+		JsonWriter->WriteArrayStart(TEXT("translation"));
+		JsonWriter->WriteValue(Translation.X);
+		JsonWriter->WriteValue(Translation.Y);
+		JsonWriter->WriteValue(Translation.Z);
+		JsonWriter->WriteArrayEnd();
+		JsonWriter->WriteArrayStart(TEXT("rotation"));
+		JsonWriter->WriteValue(Rotation.X);
+		JsonWriter->WriteValue(Rotation.Y);
+		JsonWriter->WriteValue(Rotation.Z);
+		JsonWriter->WriteValue(Rotation.W);
+		JsonWriter->WriteArrayEnd();
+		JsonWriter->WriteArrayStart(TEXT("scale"));
+		JsonWriter->WriteValue(Scale.X);
+		JsonWriter->WriteValue(Scale.Y);
+		JsonWriter->WriteValue(Scale.Z);
+		JsonWriter->WriteArrayEnd();
+
+		// Children are looked up per bone, skeletons are small enough for the quadratic scan
+		bool bHasChildren = false;
+		for (int32 ChildIndex = BoneIndex + 1; ChildIndex < NumBones; ChildIndex++)
+		{
+			if (Source.RefSkeleton->GetRawParentIndex(ChildIndex) == BoneIndex)
+			{
+				if (!bHasChildren)
+				{
+					JsonWriter->WriteArrayStart(TEXT("children"));
+					bHasChildren = true;
+				}
+				JsonWriter->WriteValue(ChildIndex + 1);
+			}
+		}
+		if (bHasChildren)
+		{
+			JsonWriter->WriteArrayEnd();
+		}
+		JsonWriter->WriteObjectEnd();
+	}
+	JsonWriter->WriteArrayEnd();
+
+	if (NumBones > 0)
+	{
+		JsonWriter->WriteArrayStart(TEXT("skins"));
+		JsonWriter->WriteObjectStart();
+		JsonWriter->WriteValue(TEXT("inverseBindMatrices"), InverseBindAccessor);
+		JsonWriter->WriteArrayStart(TEXT("joints"));
+		for (int32 BoneIndex = 0; BoneIndex < NumBones; BoneIndex++)
+		{
+			JsonWriter->WriteValue(BoneIndex + 1);
+		}
+		JsonWriter->WriteArrayEnd();
+		JsonWriter->WriteObjectEnd();
+		JsonWriter->WriteArrayEnd();
+	}
+
+	JsonWriter->WriteArrayStart(TEXT("meshes"));
+	JsonWriter->WriteObjectStart();
+	JsonWriter->WriteValue(TEXT("name"), Mesh->GetName());
+	JsonWriter->WriteArrayStart(TEXT("primitives"));
+	for (int32 SectionIndex = 0; SectionIndex < Source.Sections.Num(); SectionIndex++)
+	{
+		JsonWriter->WriteObjectStart();
+		JsonWriter->WriteObjectStart(TEXT("attributes"));
+		for (const TPair<FString, int32>& Attribute : Attributes)
+		{
+			JsonWriter->WriteValue(Attribute.Key, Attribute.Value);
+		}
+		JsonWriter->WriteObjectEnd();
+		JsonWriter->WriteValue(TEXT("indices"), SectionAccessors[SectionIndex]);
+		if (Source.MaterialSlotNames.IsValidIndex(Source.Sections[SectionIndex].MaterialIndex))
+		{
+			JsonWriter->WriteValue(TEXT("material"), Source.Sections[SectionIndex].MaterialIndex);
+		}
+		if (MorphTargetAccessors.Num() > 0)
+		{
+			JsonWriter->WriteArrayStart(TEXT("targets"));
+			for (const TPair<int32, int32>& MorphTargetAccessor : MorphTargetAccessors)
+			{
+				JsonWriter->WriteObjectStart();
+				JsonWriter->WriteValue(TEXT("POSITION"), MorphTargetAccessor.Key);
+				JsonWriter->WriteValue(TEXT("NORMAL"), MorphTargetAccessor.Value);
+				JsonWriter->WriteObjectEnd();
+			}
+			JsonWriter->WriteArrayEnd();
+		}
+		JsonWriter->WriteObjectEnd();
+	}
+	JsonWriter->WriteArrayEnd();
+
+	// Target names have no place in the core spec, extras.targetNames is what the common importers read
+	if (MorphTargetAccessors.Num() > 0)
+	{
+		JsonWriter->WriteArrayStart(TEXT("weights"));
+		for (int32 TargetIndex = 0; TargetIndex < MorphTargetAccessors.Num(); TargetIndex++)
+		{
+			JsonWriter->WriteValue(0.0f);
+		}
+		JsonWriter->WriteArrayEnd();
+		JsonWriter->WriteObjectStart(TEXT("extras"));
+		JsonWriter->WriteArrayStart(TEXT("targetNames"));
+		for (const FGlbMeshSource::FMorphTarget& MorphTarget : Source.MorphTargets)
+		{
+			JsonWriter->WriteValue(MorphTarget.Name);
+		}
+		JsonWriter->WriteArrayEnd();
+		JsonWriter->WriteObjectEnd();
+	}
+	JsonWriter->WriteObjectEnd();
+	JsonWriter->WriteArrayEnd();
+
+	if (Source.MaterialSlotNames.Num() > 0)
+	{
+		JsonWriter->WriteArrayStart(TEXT("materials"));
+		for (const FName& SlotName : Source.MaterialSlotNames)
+		{
+			JsonWriter->WriteObjectStart();
+			JsonWriter->WriteValue(TEXT("name"), SlotName.ToString());
+			JsonWriter->WriteObjectEnd();
+		}
+		JsonWriter->WriteArrayEnd();
+	}
+
+	JsonWriter->WriteArrayStart(TEXT("accessors"));
+	for (const FGlbAccessor& Accessor : Accessors)
+	{
+		JsonWriter->WriteObjectStart();
+		if (Accessor.BufferView != INDEX_NONE)
+		{
+			JsonWriter->WriteValue(TEXT("bufferView"), Accessor.BufferView);
+		}
+		if (Accessor.ByteOffset > 0)
+		{
+			JsonWriter->WriteValue(TEXT("byteOffset"), Accessor.ByteOffset);
+		}
+		JsonWriter->WriteValue(TEXT("componentType"), Accessor.ComponentType);
+		JsonWriter->WriteValue(TEXT("count"), Accessor.Count);
+		JsonWriter->WriteValue(TEXT("type"), Accessor.Type);
+		if (Accessor.bHasBounds)
+		{
+			JsonWriter->WriteArrayStart(TEXT("min"));
+			JsonWriter->WriteValue(Accessor.Min.X);
+			JsonWriter->WriteValue(Accessor.Min.Y);
+			JsonWriter->WriteValue(Accessor.Min.Z);
+			JsonWriter->WriteArrayEnd();
+			JsonWriter->WriteArrayStart(TEXT("max"));
+			JsonWriter->WriteValue(Accessor.Max.X);
+			JsonWriter->WriteValue(Accessor.Max.Y);
+			JsonWriter->WriteValue(Accessor.Max.Z);
+			JsonWriter->WriteArrayEnd();
+		}
+		if (Accessor.SparseCount > 0)
+		{
+			JsonWriter->WriteObjectStart(TEXT("sparse"));
+			JsonWriter->WriteValue(TEXT("count"), Accessor.SparseCount);
+			JsonWriter->WriteObjectStart(TEXT("indices"));
+			JsonWriter->WriteValue(TEXT("bufferView"), Accessor.SparseIndicesView);
+			JsonWriter->WriteValue(TEXT("componentType"), GltfUnsignedInt);
+			JsonWriter->WriteObjectEnd();
+			JsonWriter->WriteObjectStart(TEXT("values"));
+			JsonWriter->WriteValue(TEXT("bufferView"), Accessor.SparseValuesView);
+			JsonWriter->WriteObjectEnd();
+			JsonWriter->WriteObjectEnd();
+		}
+		JsonWriter->WriteObjectEnd();
+	}
+	JsonWriter->WriteArrayEnd();
+
+	JsonWriter->WriteArrayStart(TEXT("bufferViews"));
+	for (const FGlbBinaryChunk::FBufferView& BufferView : BinaryChunk.Views)
+	{
+		JsonWriter->WriteObjectStart();
+		JsonWriter->WriteValue(TEXT("buffer"), 0);
+		JsonWriter->WriteValue(TEXT("byteOffset"), BufferView.Offset);
+		JsonWriter->WriteValue(TEXT("byteLength"), BufferView.Length);
+		if (BufferView.Target != 0)
+		{
+			JsonWriter->WriteValue(TEXT("target"), BufferView.Target);
+		}
+		JsonWriter->WriteObjectEnd();
+	}
+	JsonWriter->WriteArrayEnd();
+
+	JsonWriter->WriteArrayStart(TEXT("buffers"));
+	JsonWriter->WriteObjectStart();
+	JsonWriter->WriteValue(TEXT("byteLength"), BinaryChunk.Data.Num());
+	JsonWriter->WriteObjectEnd();
+	JsonWriter->WriteArrayEnd();
+
+	JsonWriter->WriteObjectEnd();
+	JsonWriter->Close();
+
+	// Both chunks are padded to 4 bytes, the JSON with spaces and the binary chunk with zeros
+	const uint32 JsonPadding = Align(JsonData.Num(), 4) - JsonData.Num();
+	const uint32 BinPadding = Align(BinaryChunk.Data.Num(), 4) - BinaryChunk.Data.Num();
+	uint32 JsonChunkLength = JsonData.Num() + JsonPadding;
+	uint32 BinChunkLength = BinaryChunk.Data.Num() + BinPadding;
+	uint32 Magic = GlbMagic;
+	uint32 Version = GlbVersion;
+	uint32 TotalLength = 12 + 8 + JsonChunkLength + 8 + BinChunkLength;
+	uint32 JsonChunkType = GlbJsonChunkType;
+	uint32 BinChunkType = GlbBinChunkType;
+
+	TUniquePtr<FArchive> FileWriter(IFileManager::Get().CreateFileWriter(*OutputPath));
+	if (!FileWriter)
+	{
+		UE_LOG(LogUEMeshBPExport, Error, TEXT("Failed to export mesh: %s"), *Mesh->GetName());
+		return false;
+	}
+
+	const uint8 Spaces[4] = { ' ', ' ', ' ', ' ' };
+	const uint8 Zeros[4] = { 0, 0, 0, 0 };
+
+	*FileWriter << Magic << Version << TotalLength;
+	*FileWriter << JsonChunkLength << JsonChunkType;
+	FileWriter->Serialize(JsonData.GetData(), JsonData.Num());
+	FileWriter->Serialize(const_cast<uint8*>(Spaces), JsonPadding);
+	*FileWriter << BinChunkLength << BinChunkType;
+	FileWriter->Serialize(BinaryChunk.Data.GetData(), BinaryChunk.Data.Num());
+	FileWriter->Serialize(const_cast<uint8*>(Zeros), BinPadding);
+
+	if (!FileWriter->Close())
+	{
+		UE_LOG(LogUEMeshBPExport, Error, TEXT("Failed to export mesh: %s"), *Mesh->GetName());
+		return false;
+	}
+
+	UE_LOG(LogUEMeshBPExport, Log, TEXT("Exported mesh to: %s"), *OutputPath);
+	return true;
+}
+#endif
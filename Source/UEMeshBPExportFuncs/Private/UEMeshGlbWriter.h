@@ -0,0 +1,24 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#if WITH_EDITOR
+class UStreamableRenderAsset;
+
+/*
+*	Writes one LOD of a skeletal or static mesh as binary glTF 2.0 (.glb), read straight from the render data instead of
+*	going through the FBX SDK. Each vertex stream is converted from the vertex buffers directly into its place in the
+*	binary chunk, index buffers are copied as they are (16 or 32 bit), so no per-vertex objects are created.
+*
+*	Coordinates are converted from Unreal (left-handed, Z up, centimeters) to glTF (right-handed, Y up, meters).
+*	Every render section becomes a primitive whose material is named after its material slot, so the slot names the
+*	importer binds materials by survive. Skeletal meshes also get their reference skeleton as nodes and a skin with up
+*	to four influences per vertex.
+*
+*	With bMorphTargets the morph targets of a skeletal mesh are written as glTF morph targets. Their position and normal
+*	deltas are sparse accessors holding only the vertices the target moves, the names go into the mesh extras.
+*/
+bool ExportMeshToGlb(UStreamableRenderAsset* Mesh, const FString& OutputPath, int32 LODIndex = 0, bool bMorphTargets = false);
+#endif
@@ -0,0 +1,157 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "UEMeshImportSaver.h"
+#include "UEMeshBPExportFuncs.h"
+#include "UEMeshBPExportFuncsStats.h"
+
+#if WITH_EDITOR
+#include "UObject/Package.h"
+#include "UObject/SavePackage.h"
+#include "Misc/PackageName.h"
+#include "HAL/PlatformTime.h"
+#include "HAL/PlatformMemory.h"
+#include "UObject/UObjectGlobals.h"
+#include "PackageTools.h"
+
+TSet<TWeakObjectPtr<UPackage>> FUEMeshImportSaver::PendingPackages;
+FUEMeshImportStats FUEMeshImportSaver::BatchStats;
+
+// Helper function: Resident memory of the process in MiB
+static double GetUsedMemoryMB()
+{
+	return FPlatformMemory::GetStats().UsedPhysical / (1024.0 * 1024.0);
+}
+
+FUEMeshImportSaver::FUEMeshImportSaver(const FString& TargetUEPath, EUEMeshImportSavePolicy InPolicy, int32 InSaveBatchSize, int32 InMemoryBudgetMB, FUEMeshImportStats& InStats)
+	: RootPath(TargetUEPath.EndsWith(TEXT("/")) ? TargetUEPath : TargetUEPath + TEXT("/"))
+	, Policy(InPolicy)
+	, SaveBatchSize(FMath::Max(InSaveBatchSize, 1))
+	, MemoryBudgetMB(FMath::Max(InMemoryBudgetMB, 0))
+	, Stats(InStats)
+{
+	if (Policy != EUEMeshImportSavePolicy::None || MemoryBudgetMB > 0)
+	{
+		MarkedDirtyHandle = UPackage::PackageMarkedDirtyEvent.AddRaw(this, &FUEMeshImportSaver::OnPackageMarkedDirty);
+	}
+}
+
+FUEMeshImportSaver::~FUEMeshImportSaver()
+{
+	if (MarkedDirtyHandle.IsValid())
+	{
+		UPackage::PackageMarkedDirtyEvent.Remove(MarkedDirtyHandle);
+	}
+}
+
+void FUEMeshImportSaver::OnPackageMarkedDirty(UPackage* Package, bool bWasDirty)
+{
+	// Only what the import writes, packages the user has open elsewhere are left alone
+	if (Package && Package->GetName().StartsWith(RootPath))
+	{
+		PendingPackages.Add(Package);
+	}
+}
+
+void FUEMeshImportSaver::MeshFinished()
+{
+	if ((Policy == EUEMeshImportSavePolicy::PerMesh && PendingPackages.Num() > 0)
+		|| (Policy == EUEMeshImportSavePolicy::EveryNPackages && PendingPackages.Num() >= SaveBatchSize))
+	{
+		SaveAll(&Stats);
+	}
+
+	EnforceMemoryBudget();
+}
+
+void FUEMeshImportSaver::EnforceMemoryBudget()
+{
+	const double UsedMemoryMB = GetUsedMemoryMB();
+	Stats.PeakMemoryMB = FMath::Max(Stats.PeakMemoryMB, UsedMemoryMB);
+	if (MemoryBudgetMB <= 0 || UsedMemoryMB <= MemoryBudgetMB)
+	{
+		return;
+	}
+
+	TRACE_CPUPROFILER_EVENT_SCOPE(UEMeshBPExport_EnforceMemoryBudget);
+
+	// Unloading already collects garbage, with nothing to unload the factories, tasks and FBX scenes still need a pass
+	if (SaveAll(&Stats) == 0)
+	{
+		const double CollectStartTime = FPlatformTime::Seconds();
+		CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+		Stats.SaveSeconds += FPlatformTime::Seconds() - CollectStartTime;
+	}
+	Stats.NumGarbageCollections++;
+
+	// Freed blocks stay cached in the allocator and would still count as resident
+	GMalloc->Trim(true);
+
+	const double CollectedMemoryMB = GetUsedMemoryMB();
+	UE_LOG(LogUEMeshBPExport, Log, TEXT("Import memory %.0f MB above the budget of %d MB, collected garbage down to %.0f MB"), UsedMemoryMB, MemoryBudgetMB, CollectedMemoryMB);
+	if (CollectedMemoryMB > MemoryBudgetMB)
+	{
+		UE_LOG(LogUEMeshBPExport, Warning, TEXT("Import memory is still above the budget of %d MB after garbage collection, the budget is below what the editor itself needs"), MemoryBudgetMB);
+	}
+}
+
+FUEMeshImportStats& FUEMeshImportSaver::GetBatchStats()
+{
+	return BatchStats;
+}
+
+int32 FUEMeshImportSaver::SaveAll(FUEMeshImportStats* Stats)
+{
+	TArray<UPackage*> PackagesToSave;
+	for (const TWeakObjectPtr<UPackage>& Package : PendingPackages)
+	{
+		// Saved by someone else in the meantime, or already gone
+		if (Package.IsValid() && Package->IsDirty())
+		{
+			PackagesToSave.Add(Package.Get());
+		}
+	}
+	PendingPackages.Reset();
+
+	if (PackagesToSave.Num() == 0)
+	{
+		return 0;
+	}
+
+	TRACE_CPUPROFILER_EVENT_SCOPE(UEMeshBPExport_SaveImportedPackages);
+	const double SaveStartTime = FPlatformTime::Seconds();
+
+	FSavePackageArgs SaveArgs;
+	SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
+	SaveArgs.SaveFlags = SAVE_NoError;
+
+	TArray<UPackage*> SavedPackages;
+	for (UPackage* Package : PackagesToSave)
+	{
+		const FString PackageFilename = FPackageName::LongPackageNameToFilename(Package->GetName(), FPackageName::GetAssetPackageExtension());
+		if (UPackage::SavePackage(Package, nullptr, *PackageFilename, SaveArgs))
+		{
+			SavedPackages.Add(Package);
+		}
+		else
+		{
+			UE_LOG(LogUEMeshBPExport, Error, TEXT("Failed to save imported package: %s"), *Package->GetName());
+		}
+	}
+
+	// Unloading drops the standalone assets and collects garbage, failed packages stay loaded and dirty
+	FText UnloadError;
+	if (!UPackageTools::UnloadPackages(SavedPackages, UnloadError))
+	{
+		UE_LOG(LogUEMeshBPExport, Warning, TEXT("Failed to unload saved packages: %s"), *UnloadError.ToString());
+	}
+
+	const double SaveSeconds = FPlatformTime::Seconds() - SaveStartTime;
+	UE_LOG(LogUEMeshBPExport, Log, TEXT("Saved %d of %d imported packages in %.2fs"), SavedPackages.Num(), PackagesToSave.Num(), SaveSeconds);
+	if (Stats)
+	{
+		Stats->NumPackagesSaved += SavedPackages.Num();
+		Stats->SaveSeconds += SaveSeconds;
+	}
+	return SavedPackages.Num();
+}
+#endif
@@ -0,0 +1,52 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UEMeshBPExportFuncsTypes.h"
+#include "UObject/WeakObjectPtrTemplates.h"
+
+#if WITH_EDITOR
+class UPackage;
+
+/*
+*	Save policy of ImportMesh and ImportMeshes.
+*	While an instance exists, every package marked dirty below the import destination is remembered. The packages are
+*	saved with UPackage::SavePackage and then unloaded, which runs a garbage collection, so a batch of thousands of meshes
+*	never holds more than one batch of unsaved assets. Packages still pending when the instance ends (EveryNPackages
+*	with fewer than SaveBatchSize left) stay pending for the next import, or are written by SaveAll.
+*
+*	With a memory budget the resident memory is sampled after every mesh. Above the budget the pending packages are saved
+*	and unloaded whatever the policy, since dirty packages cannot be unloaded without losing them, and garbage is collected.
+*/
+class FUEMeshImportSaver
+{
+public:
+	FUEMeshImportSaver(const FString& TargetUEPath, EUEMeshImportSavePolicy InPolicy, int32 InSaveBatchSize, int32 InMemoryBudgetMB, FUEMeshImportStats& InStats);
+	~FUEMeshImportSaver();
+
+	/** Call once a mesh and its materials are complete, saves if the policy or the memory budget says so */
+	void MeshFinished();
+
+	/** Saves and unloads every pending package, including those left by earlier imports. Returns the number saved. */
+	static int32 SaveAll(FUEMeshImportStats* Stats = nullptr);
+
+	/** Stats of the ImportMesh calls since the last SaveImportedPackages, ImportMesh has no stats output of its own */
+	static FUEMeshImportStats& GetBatchStats();
+
+private:
+	void OnPackageMarkedDirty(UPackage* Package, bool bWasDirty);
+
+	void EnforceMemoryBudget();
+
+	FString RootPath;
+	EUEMeshImportSavePolicy Policy;
+	int32 SaveBatchSize;
+	int32 MemoryBudgetMB;
+	FUEMeshImportStats& Stats;
+	FDelegateHandle MarkedDirtyHandle;
+
+	static TSet<TWeakObjectPtr<UPackage>> PendingPackages;
+	static FUEMeshImportStats BatchStats;
+};
+#endif
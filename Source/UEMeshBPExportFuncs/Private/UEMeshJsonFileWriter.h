@@ -0,0 +1,41 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/FileManager.h"
+#include "Policies/CondensedJsonPrintPolicy.h"
+#include "Policies/PrettyJsonPrintPolicy.h"
+#include "Serialization/JsonWriter.h"
+#include "Templates/UniquePtr.h"
+
+/*
+*	Streams a JSON document as UTF-8 straight into a file, without building an FJsonObject DOM or an intermediate FString.
+*	WriteBody is called with a TJsonWriter<UTF8CHAR, PrintPolicy>& and must write exactly one root value, so it is
+*	usually a generic lambda: WriteJsonFile(Path, bCompact, [&](auto& Writer) { Writer.WriteObjectStart(); ... });
+*/
+template <typename WriteBodyFunc>
+bool WriteJsonFile(const FString& FilePath, bool bCompact, WriteBodyFunc&& WriteBody)
+{
+	TUniquePtr<FArchive> FileWriter(IFileManager::Get().CreateFileWriter(*FilePath));
+	if (!FileWriter)
+	{
+		return false;
+	}
+
+	if (bCompact)
+	{
+		TSharedRef<TJsonWriter<UTF8CHAR, TCondensedJsonPrintPolicy<UTF8CHAR>>> JsonWriter = TJsonWriterFactory<UTF8CHAR, TCondensedJsonPrintPolicy<UTF8CHAR>>::Create(FileWriter.Get());
+		WriteBody(*JsonWriter);
+		JsonWriter->Close();
+	}
+	else
+	{
+		TSharedRef<TJsonWriter<UTF8CHAR, TPrettyJsonPrintPolicy<UTF8CHAR>>> JsonWriter = TJsonWriterFactory<UTF8CHAR, TPrettyJsonPrintPolicy<UTF8CHAR>>::Create(FileWriter.Get());
+		WriteBody(*JsonWriter);
+		JsonWriter->Close();
+	}
+
+	// Close flushes the buffered tail of the file and reports any write error
+	return FileWriter->Close();
+}
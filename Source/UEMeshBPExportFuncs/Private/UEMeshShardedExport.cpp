@@ -0,0 +1,181 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "UEMeshShardedExport.h"
+#include "UEMeshBPExportFuncs.h"
+#include "UEMeshBPExportFuncsBPLibrary.h"
+
+#if WITH_EDITOR
+#include "UEMeshExportSession.h"
+#include "UEMeshExportStateCache.h"
+#include "UEMeshWorkerProcess.h"
+#include "Engine/StreamableRenderAsset.h"
+#include "Materials/MaterialInterface.h"
+#include "UObject/Package.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/PackageName.h"
+#include "Misc/Paths.h"
+
+// Helper function: Add the export work of a worker to the stats of the sharded export
+static void AddWorkerStats(FUEMeshExportStats& OutStats, const FUEMeshExportStats& WorkerStats)
+{
+	OutStats.NumMeshes += WorkerStats.NumMeshes;
+	OutStats.NumMaterials += WorkerStats.NumMaterials;
+	OutStats.NumTextures += WorkerStats.NumTextures;
+	OutStats.NumTexturesDeduplicated += WorkerStats.NumTexturesDeduplicated;
+	OutStats.NumCacheMisses += WorkerStats.NumCacheMisses;
+	OutStats.BytesWritten += WorkerStats.BytesWritten;
+	OutStats.MeshExportSeconds += WorkerStats.MeshExportSeconds;
+	OutStats.MaterialExportSeconds += WorkerStats.MaterialExportSeconds;
+	OutStats.TextureExportSeconds += WorkerStats.TextureExportSeconds;
+}
+
+bool ExportSkelMeshesSharded(const TArray<AActor*>& Actors, const FString& ExportPath, const FUEMeshExportOptions& Options, FUEMeshExportStats& OutStats)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UEMeshBPExport_ExportSharded);
+	const double StartTime = FPlatformTime::Seconds();
+
+	FUEMeshExportOptions InProcessOptions = Options;
+	InProcessOptions.NumWorkers = 0;
+
+	// The same unique mesh set the in-process export builds
+	TArray<UStreamableRenderAsset*> Meshes;
+	{
+		FUEMeshExportSession Planner(ExportPath, InProcessOptions);
+		for (AActor* Actor : Actors)
+		{
+			TArray<UStreamableRenderAsset*> ActorMeshes;
+			if (Actor && Planner.CollectActorMeshes(Actor, ActorMeshes))
+			{
+				for (UStreamableRenderAsset* Mesh : ActorMeshes)
+				{
+					Meshes.AddUnique(Mesh);
+				}
+			}
+		}
+	}
+
+	// Workers load the saved packages, anything else is left to the in-process pass
+	Meshes.RemoveAll([](UStreamableRenderAsset* Mesh)
+	{
+		const UPackage* Package = Mesh->GetPackage();
+		return Package->IsDirty() || !FPackageName::DoesPackageExist(Package->GetName());
+	});
+
+	const TArray<TArray<UStreamableRenderAsset*>> Shards = FUEMeshExportSession::PartitionMeshes(Meshes, Options.NumWorkers);
+	if (Shards.Num() < 2)
+	{
+		UE_LOG(LogUEMeshBPExport, Log, TEXT("ExportSkelMeshesSharded: %d meshes do not split into shards, exporting in process"), Meshes.Num());
+		return UUEMeshBPExportFuncsBPLibrary::ExportSkelMeshesBatch(Actors, ExportPath, InProcessOptions, OutStats);
+	}
+
+	const FString ShardDirectory = FPaths::ConvertRelativePathToFull(FPaths::Combine(ExportPath, TEXT(".uemeshexport_shards")));
+	IFileManager::Get().MakeDirectory(*ShardDirectory, true);
+
+	const FString ExportRoot = FPaths::ConvertRelativePathToFull(ExportPath);
+
+	TArray<FUEMeshWorkerProcess> Workers;
+	TArray<FString> StateChangesPaths;
+	for (int32 ShardIndex = 0; ShardIndex < Shards.Num(); ShardIndex++)
+	{
+		FUEMeshWorkerProcess& Worker = Workers.Emplace_GetRef(ShardDirectory, FString::Printf(TEXT("Shard%d"), ShardIndex));
+		const FString& StateChangesPath = StateChangesPaths.Add_GetRef(FPaths::Combine(ShardDirectory, FString::Printf(TEXT("Shard%d.state.json"), ShardIndex)));
+		IFileManager::Get().Delete(*StateChangesPath, false, true, true);
+
+		// The binary manifest is written once by the in-process pass, so are skeletons and animations, as shards may share a skeleton
+		FUEMeshJob Job;
+		FUEMeshExportShardJob& ShardJob = Job.ExportShards.AddDefaulted_GetRef();
+		ShardJob.ExportPath = ExportRoot;
+		ShardJob.Options = InProcessOptions;
+		ShardJob.Options.bWriteBinaryManifest = false;
+		ShardJob.Options.bExportAnimations = false;
+		ShardJob.StateChangesFile = StateChangesPath;
+		for (UStreamableRenderAsset* Mesh : Shards[ShardIndex])
+		{
+			ShardJob.Meshes.Add(Mesh->GetPathName());
+		}
+
+		Worker.Launch(Job);
+	}
+
+	UE_LOG(LogUEMeshBPExport, Log, TEXT("ExportSkelMeshesSharded: Exporting %d meshes with %d workers"), Meshes.Num(), Workers.Num());
+
+	// Outputs of the workers become cache hits of the pass below, failed shards are simply exported by it
+	FUEMeshExportStats WorkerStats;
+	FUEMeshExportStateCache StateCache;
+	StateCache.Load(ExportPath);
+	bool bAllWorkersSucceeded = true;
+	for (int32 WorkerIndex = 0; WorkerIndex < Workers.Num(); WorkerIndex++)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(UEMeshBPExport_WaitForWorker);
+
+		FUEMeshJobReport Report;
+		if (Workers[WorkerIndex].Wait(Report) != 0)
+		{
+			bAllWorkersSucceeded = false;
+		}
+		for (const FUEMeshExportShardResult& ShardResult : Report.ExportShards)
+		{
+			AddWorkerStats(WorkerStats, ShardResult.Stats);
+		}
+
+		// Whatever a failed worker did record is still valid
+		StateCache.MergeChanges(StateChangesPaths[WorkerIndex]);
+	}
+	const double WorkerSeconds = FPlatformTime::Seconds() - StartTime;
+	StateCache.Save();
+
+	if (bAllWorkersSucceeded)
+	{
+		IFileManager::Get().DeleteDirectory(*ShardDirectory, false, true);
+	}
+
+	const bool bSuccess = UUEMeshBPExportFuncsBPLibrary::ExportSkelMeshesBatch(Actors, ExportPath, InProcessOptions, OutStats);
+
+	AddWorkerStats(OutStats, WorkerStats);
+	OutStats.NumWorkers = Workers.Num();
+	OutStats.WorkerSeconds = WorkerSeconds;
+	OutStats.TotalSeconds = FPlatformTime::Seconds() - StartTime;
+
+	UE_LOG(LogUEMeshBPExport, Log, TEXT("ExportSkelMeshesSharded: %d workers finished in %.2fs, manifests written after %.2fs"),
+		Workers.Num(), WorkerSeconds, OutStats.TotalSeconds);
+	return bSuccess;
+}
+
+bool RunExportShard(const FUEMeshExportShardJob& Job, FUEMeshExportShardResult& OutResult)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UEMeshBPExport_ExportShard);
+
+	FUEMeshExportSession Session(Job.ExportPath, Job.Options);
+	if (!Session.Initialize())
+	{
+		OutResult.FailedMeshes = Job.Meshes;
+		return false;
+	}
+	Session.SetStateChangesFile(Job.StateChangesFile);
+
+	// No manifests, the coordinator writes them once every shard is done
+	for (const FString& MeshPath : Job.Meshes)
+	{
+		UStreamableRenderAsset* Mesh = LoadObject<UStreamableRenderAsset>(nullptr, *MeshPath);
+		TArray<UMaterialInterface*> Materials;
+		if (!Mesh || !Session.ExportMeshFile(Mesh, Materials))
+		{
+			UE_LOG(LogUEMeshBPExport, Error, TEXT("UEMeshBPExport: Failed to export shard mesh %s"), *MeshPath);
+			OutResult.FailedMeshes.Add(MeshPath);
+			continue;
+		}
+
+		for (UMaterialInterface* Material : Materials)
+		{
+			Session.ExportMaterial(Material);
+		}
+		Session.FinishMesh(Mesh);
+	}
+
+	Session.Finish();
+	OutResult.Stats = Session.GetStats();
+	OutResult.bSuccess = OutResult.FailedMeshes.Num() == 0;
+	return OutResult.bSuccess;
+}
+#endif
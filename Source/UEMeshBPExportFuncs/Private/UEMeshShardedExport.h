@@ -0,0 +1,25 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UEMeshBPExportFuncsTypes.h"
+
+#if WITH_EDITOR
+class AActor;
+
+/*
+*	Sharded export, used by ExportSkelMeshesBatch when FUEMeshExportOptions::NumWorkers is above 1.
+*	The unique meshes of the actors are split with FUEMeshExportSession::PartitionMeshes and every shard is exported by a
+*	headless editor process (the UEMeshBPExport commandlet with an ExportShards job) into the same export root. Each worker
+*	writes the export state it recorded into its own file. Once all have exited, the files are merged into the state file of
+*	the export root and the actor manifests are written in process, where every output of the workers is a cache hit.
+*	Anything a worker failed to export is exported by that pass as well, as are meshes with unsaved changes.
+*
+*	Worker job files, reports and logs go to <ExportPath>/.uemeshexport_shards and are kept if a worker failed.
+*/
+bool ExportSkelMeshesSharded(const TArray<AActor*>& Actors, const FString& ExportPath, const FUEMeshExportOptions& Options, FUEMeshExportStats& OutStats);
+
+/** Worker side of a sharded export, run by the commandlet for every entry of FUEMeshJob::ExportShards */
+bool RunExportShard(const FUEMeshExportShardJob& Job, FUEMeshExportShardResult& OutResult);
+#endif
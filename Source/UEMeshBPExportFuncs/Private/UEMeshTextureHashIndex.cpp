@@ -0,0 +1,237 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "UEMeshTextureHashIndex.h"
+#include "UEMeshBPExportFuncs.h"
+#include "UEMeshBPExportFuncsStats.h"
+
+#if WITH_EDITOR
+#include "Engine/Texture2D.h"
+#include "Hash/xxhash.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/Parse.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "UEMeshJsonFileWriter.h"
+
+static const int32 TextureHashIndexVersion = 2;
+
+TMap<uint64, TArray<FUEMeshTextureHashIndex::FEntry>> FUEMeshTextureHashIndex::Entries;
+bool FUEMeshTextureHashIndex::bLoaded = false;
+bool FUEMeshTextureHashIndex::bDirty = false;
+TMap<uint64, TArray<FUEMeshTextureHashIndex::FEntry>> FUEMeshTextureHashIndex::AddedEntries;
+FString FUEMeshTextureHashIndex::ChangesFilePath;
+
+uint64 FUEMeshTextureHashIndex::HashFileData(const void* Data, int64 Size)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UEMeshBPExport_HashTextureFile);
+	return FXxHash64::HashBuffer(Data, Size).Hash;
+}
+
+FString FUEMeshTextureHashIndex::GetIndexFilePath()
+{
+	return FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("UEMeshBPExport"), TEXT("TextureHashIndex.json"));
+}
+
+bool FUEMeshTextureHashIndex::ReadIndexFile(const FString& FilePath, TMap<uint64, TArray<FEntry>>& OutEntries)
+{
+	FString JsonString;
+	if (!FFileHelper::LoadFileToString(JsonString, *FilePath))
+	{
+		return false;
+	}
+
+	TSharedPtr<FJsonObject> IndexJson;
+	TSharedRef<TJsonReader<>> JsonReader = TJsonReaderFactory<>::Create(JsonString);
+	int32 Version = 0;
+	if (!FJsonSerializer::Deserialize(JsonReader, IndexJson) || !IndexJson.IsValid()
+		|| !IndexJson->TryGetNumberField(TEXT("Version"), Version) || Version != TextureHashIndexVersion)
+	{
+		UE_LOG(LogUEMeshBPExport, Log, TEXT("Texture hash index is unreadable or outdated, starting a new one: %s"), *FilePath);
+		return false;
+	}
+
+	const TArray<TSharedPtr<FJsonValue>>* TexturesJson = nullptr;
+	if (!IndexJson->TryGetArrayField(TEXT("Textures"), TexturesJson))
+	{
+		return true;
+	}
+
+	for (const TSharedPtr<FJsonValue>& TextureValue : *TexturesJson)
+	{
+		const TSharedPtr<FJsonObject>* TextureJson = nullptr;
+		if (!TextureValue.IsValid() || !TextureValue->TryGetObject(TextureJson))
+		{
+			continue;
+		}
+
+		FString HashString;
+		FEntry Entry;
+		int32 CompressionSettings = TC_Default;
+		if ((*TextureJson)->TryGetStringField(TEXT("Hash"), HashString)
+			&& (*TextureJson)->TryGetBoolField(TEXT("SRGB"), Entry.bSRGB)
+			&& (*TextureJson)->TryGetNumberField(TEXT("Compression"), CompressionSettings)
+			&& (*TextureJson)->TryGetStringField(TEXT("Object"), Entry.ObjectPath)
+			&& (*TextureJson)->TryGetStringField(TEXT("SourceId"), Entry.SourceId))
+		{
+			Entry.CompressionSettings = (TextureCompressionSettings)CompressionSettings;
+			OutEntries.FindOrAdd(FParse::HexNumber64(*HashString)).Add(MoveTemp(Entry));
+		}
+	}
+	return true;
+}
+
+bool FUEMeshTextureHashIndex::WriteIndexFile(const FString& FilePath, const TMap<uint64, TArray<FEntry>>& IndexEntries)
+{
+	IFileManager::Get().MakeDirectory(*FPaths::GetPath(FilePath), true);
+
+	const bool bSaved = WriteJsonFile(FilePath, true, [&IndexEntries](auto& JsonWriter)
+	{
+		JsonWriter.WriteObjectStart();
+		JsonWriter.WriteValue(TEXT("Version"), TextureHashIndexVersion);
+
+		JsonWriter.WriteArrayStart(TEXT("Textures"));
+		for (const TPair<uint64, TArray<FEntry>>& HashEntries : IndexEntries)
+		{
+			for (const FEntry& Entry : HashEntries.Value)
+			{
+				JsonWriter.WriteObjectStart();
+				JsonWriter.WriteValue(TEXT("Hash"), FString::Printf(TEXT("%016llx"), HashEntries.Key));
+				JsonWriter.WriteValue(TEXT("SRGB"), Entry.bSRGB);
+				JsonWriter.WriteValue(TEXT("Compression"), (int32)Entry.CompressionSettings);
+				JsonWriter.WriteValue(TEXT("Object"), Entry.ObjectPath);
+				JsonWriter.WriteValue(TEXT("SourceId"), Entry.SourceId);
+				JsonWriter.WriteObjectEnd();
+			}
+		}
+		JsonWriter.WriteArrayEnd();
+
+		JsonWriter.WriteObjectEnd();
+	});
+
+	if (!bSaved)
+	{
+		UE_LOG(LogUEMeshBPExport, Error, TEXT("Failed to save texture hash index: %s"), *FilePath);
+	}
+	return bSaved;
+}
+
+void FUEMeshTextureHashIndex::EnsureLoaded()
+{
+	if (bLoaded)
+	{
+		return;
+	}
+	bLoaded = true;
+
+	ReadIndexFile(GetIndexFilePath(), Entries);
+}
+
+bool FUEMeshTextureHashIndex::Contains(uint64 FileHash)
+{
+	return Entries.Contains(FileHash);
+}
+
+UTexture2D* FUEMeshTextureHashIndex::Find(uint64 FileHash, bool bSRGB, TextureCompressionSettings CompressionSettings)
+{
+	EnsureLoaded();
+
+	TArray<FEntry>* HashEntries = Entries.Find(FileHash);
+	if (!HashEntries)
+	{
+		return nullptr;
+	}
+
+	for (int32 Index = 0; Index < HashEntries->Num(); Index++)
+	{
+		const FEntry& Entry = (*HashEntries)[Index];
+		if (Entry.bSRGB != bSRGB || Entry.CompressionSettings != CompressionSettings)
+		{
+			continue;
+		}
+
+		// Deleted, renamed, reimported or recompressed since, the entry no longer describes the file
+		UTexture2D* Texture = LoadObject<UTexture2D>(nullptr, *Entry.ObjectPath, nullptr, LOAD_NoWarn | LOAD_Quiet);
+		if (Texture && Texture->Source.GetId().ToString() == Entry.SourceId && Texture->CompressionSettings == CompressionSettings)
+		{
+			return Texture;
+		}
+
+		HashEntries->RemoveAt(Index--);
+		bDirty = true;
+	}
+
+	if (HashEntries->Num() == 0)
+	{
+		Entries.Remove(FileHash);
+	}
+	return nullptr;
+}
+
+void FUEMeshTextureHashIndex::Add(uint64 FileHash, bool bSRGB, TextureCompressionSettings CompressionSettings, UTexture2D* Texture)
+{
+	EnsureLoaded();
+
+	FEntry& Entry = Entries.FindOrAdd(FileHash).AddDefaulted_GetRef();
+	Entry.bSRGB = bSRGB;
+	Entry.CompressionSettings = CompressionSettings;
+	Entry.ObjectPath = Texture->GetPathName();
+	Entry.SourceId = Texture->Source.GetId().ToString();
+	AddedEntries.FindOrAdd(FileHash).Add(Entry);
+	bDirty = true;
+}
+
+bool FUEMeshTextureHashIndex::Save()
+{
+	if (!bDirty)
+	{
+		return true;
+	}
+
+	// Workers of a sharded import share the index file, each only writes what it added
+	const bool bSaved = ChangesFilePath.IsEmpty() ? WriteIndexFile(GetIndexFilePath(), Entries) : WriteIndexFile(ChangesFilePath, AddedEntries);
+	if (bSaved)
+	{
+		bDirty = false;
+	}
+	return bSaved;
+}
+
+void FUEMeshTextureHashIndex::SetChangesFile(const FString& FilePath)
+{
+	ChangesFilePath = FilePath;
+}
+
+bool FUEMeshTextureHashIndex::MergeChanges(const FString& FilePath)
+{
+	EnsureLoaded();
+
+	TMap<uint64, TArray<FEntry>> ChangedEntries;
+	if (!ReadIndexFile(FilePath, ChangedEntries))
+	{
+		return false;
+	}
+
+	for (TPair<uint64, TArray<FEntry>>& HashEntries : ChangedEntries)
+	{
+		TArray<FEntry>& ExistingEntries = Entries.FindOrAdd(HashEntries.Key);
+		for (FEntry& Entry : HashEntries.Value)
+		{
+			ExistingEntries.RemoveAll([&Entry](const FEntry& ExistingEntry) { return ExistingEntry.ObjectPath == Entry.ObjectPath; });
+			ExistingEntries.Add(MoveTemp(Entry));
+		}
+	}
+	bDirty = true;
+	return true;
+}
+
+void FUEMeshTextureHashIndex::Reload()
+{
+	Entries.Reset();
+	AddedEntries.Reset();
+	bDirty = false;
+	bLoaded = false;
+	EnsureLoaded();
+}
+#endif
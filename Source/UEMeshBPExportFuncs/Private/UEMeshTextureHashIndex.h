@@ -0,0 +1,73 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#if WITH_EDITOR
+#include "Engine/TextureDefines.h"
+
+class UTexture2D;
+
+/*
+*	Index of the textures created by ImportMeshes, keyed by the xxHash64 of the image file they were imported from.
+*	A file whose bytes were imported before resolves to the existing UTexture2D, whatever its path, so the same image
+*	stored under several source paths is decoded and compressed once. Stored in <ProjectSaved>/UEMeshBPExport/
+*	TextureHashIndex.json and loaded on first use, so it also covers textures imported in earlier editor sessions.
+*
+*	Entries are checked when they are used: the texture has to load and still hold the source it was imported with.
+*	Stale entries are dropped. Game thread only, except Contains.
+*/
+class FUEMeshTextureHashIndex
+{
+public:
+	/** Hash of an image file as used by the index */
+	static uint64 HashFileData(const void* Data, int64 Size);
+
+	/** Reads the index file unless it is loaded already */
+	static void EnsureLoaded();
+
+	/** True if any texture was imported from a file with this hash. Thread safe while nothing is added, after EnsureLoaded. */
+	static bool Contains(uint64 FileHash);
+
+	/** The texture imported from a file with this hash, sRGB and compression setting, null if there is none or it changed since */
+	static UTexture2D* Find(uint64 FileHash, bool bSRGB, TextureCompressionSettings CompressionSettings);
+
+	/** Remembers a texture created from a file with this hash */
+	static void Add(uint64 FileHash, bool bSRGB, TextureCompressionSettings CompressionSettings, UTexture2D* Texture);
+
+	/** Writes the index if anything changed since it was loaded */
+	static bool Save();
+
+	/** Makes Save write only the entries added by this process into FilePath, for the workers of a sharded import */
+	static void SetChangesFile(const FString& FilePath);
+
+	/** Adds the entries of a file written by a worker, the index file is written by the next Save */
+	static bool MergeChanges(const FString& FilePath);
+
+	/** Drops everything added since the last Save and reads the index file again, for runs whose textures must not be remembered */
+	static void Reload();
+
+private:
+	struct FEntry
+	{
+		bool bSRGB = false;
+		TextureCompressionSettings CompressionSettings = TC_Default;
+		FString ObjectPath;
+		/** Source id of the texture at import, a reimport or source edit changes it */
+		FString SourceId;
+	};
+
+	static FString GetIndexFilePath();
+
+	static bool ReadIndexFile(const FString& FilePath, TMap<uint64, TArray<FEntry>>& OutEntries);
+	static bool WriteIndexFile(const FString& FilePath, const TMap<uint64, TArray<FEntry>>& IndexEntries);
+
+	static TMap<uint64, TArray<FEntry>> Entries;
+	/** Entries added since the index was loaded, see SetChangesFile */
+	static TMap<uint64, TArray<FEntry>> AddedEntries;
+	static FString ChangesFilePath;
+	static bool bLoaded;
+	static bool bDirty;
+};
+#endif
@@ -0,0 +1,154 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "UEMeshTextureWriter.h"
+#include "UEMeshBPExportFuncs.h"
+#include "UEMeshBPExportFuncsStats.h"
+
+#if WITH_EDITOR
+#include "ImageCore.h"
+#include "IImageWrapper.h"
+#include "IImageWrapperModule.h"
+
+static constexpr uint32 DdsMagic = 0x20534444; // "DDS "
+static constexpr uint32 DdsFourCCDX10 = 0x30315844; // "DX10"
+static constexpr uint32 DdsHeaderFlags = 0x1 | 0x2 | 0x4 | 0x8 | 0x1000 | 0x20000; // CAPS, HEIGHT, WIDTH, PITCH, PIXELFORMAT, MIPMAPCOUNT
+static constexpr uint32 DdsPixelFormatFourCC = 0x4;
+static constexpr uint32 DdsCaps = 0x8 | 0x1000 | 0x400000; // COMPLEX, TEXTURE, MIPMAP
+static constexpr uint32 DdsDimensionTexture2D = 3;
+
+// DXGI formats of the raw image formats written as they are
+static constexpr uint32 DxgiR32G32B32A32Float = 2;
+static constexpr uint32 DxgiR16G16B16A16Float = 10;
+static constexpr uint32 DxgiR16G16B16A16Unorm = 11;
+static constexpr uint32 DxgiR16Float = 54;
+static constexpr uint32 DxgiR16Unorm = 56;
+static constexpr uint32 DxgiR8Unorm = 61;
+static constexpr uint32 DxgiB8G8R8A8Unorm = 87;
+static constexpr uint32 DxgiB8G8R8A8UnormSrgb = 91;
+
+const TCHAR* GetTextureFormatExtension(EUEMeshTextureFormat Format)
+{
+	switch (Format)
+	{
+	case EUEMeshTextureFormat::TGA:
+		return TEXT("tga");
+	case EUEMeshTextureFormat::EXR:
+		return TEXT("exr");
+	case EUEMeshTextureFormat::DDS:
+		return TEXT("dds");
+	default:
+		return TEXT("png");
+	}
+}
+
+int32 GetTextureExportMip(int32 SizeX, int32 SizeY, const FUEMeshExportOptions& Options)
+{
+	int32 Mip = FMath::Max(Options.TextureMipLevel, 0);
+	if (Options.MaxTextureSize > 0)
+	{
+		while (FMath::Max(SizeX, SizeY) >> Mip > Options.MaxTextureSize)
+		{
+			Mip++;
+		}
+	}
+
+	// Never past the 1x1 mip
+	return FMath::Min(Mip, (int32)FMath::FloorLog2(FMath::Max(FMath::Max(SizeX, SizeY), 1)));
+}
+
+// Helper function: DXGI format of a raw image format, converts the image to RGBA32F where there is none
+static uint32 GetDdsFormat(FImage& Image)
+{
+	switch (Image.Format)
+	{
+	case ERawImageFormat::G8:
+		return DxgiR8Unorm;
+	case ERawImageFormat::G16:
+		return DxgiR16Unorm;
+	case ERawImageFormat::R16F:
+		return DxgiR16Float;
+	case ERawImageFormat::BGRA8:
+		return Image.IsGammaCorrected() ? DxgiB8G8R8A8UnormSrgb : DxgiB8G8R8A8Unorm;
+	case ERawImageFormat::RGBA16:
+		return DxgiR16G16B16A16Unorm;
+	case ERawImageFormat::RGBA16F:
+		return DxgiR16G16B16A16Float;
+	case ERawImageFormat::RGBA32F:
+		return DxgiR32G32B32A32Float;
+	default:
+		{
+			FImage Converted;
+			Image.CopyTo(Converted, ERawImageFormat::RGBA32F, EGammaSpace::Linear);
+			Image = MoveTemp(Converted);
+			return DxgiR32G32B32A32Float;
+		}
+	}
+}
+
+// Helper function: Uncompressed DDS (DX10 header) of Image and its mips down to 1x1
+static void EncodeDds(FImage& Image, TArray64<uint8>& OutData)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UEMeshBPExport_EncodeTextureDDS);
+
+	const uint32 DxgiFormat = GetDdsFormat(Image);
+	const int32 NumMips = (int32)FMath::FloorLog2(FMath::Max(FMath::Max(Image.SizeX, Image.SizeY), 1)) + 1;
+
+	// Magic, the 124 byte header and the DX10 extension, all little-endian dwords
+	uint32 Header[1 + 31 + 5] = {};
+	Header[0] = DdsMagic;
+	Header[1] = 124;
+	Header[2] = DdsHeaderFlags;
+	Header[3] = Image.SizeY;
+	Header[4] = Image.SizeX;
+	Header[5] = Image.SizeX * Image.GetBytesPerPixel();
+	Header[7] = NumMips;
+	Header[19] = 32; // Pixel format size
+	Header[20] = DdsPixelFormatFourCC;
+	Header[21] = DdsFourCCDX10;
+	Header[27] = DdsCaps;
+	Header[32] = DxgiFormat;
+	Header[33] = DdsDimensionTexture2D;
+	Header[35] = 1; // Array size
+
+	// The whole chain is at most a third larger than the top mip
+	OutData.Reset(sizeof(Header) + Image.RawData.Num() * 4 / 3 + 64);
+	OutData.Append(reinterpret_cast<const uint8*>(Header), sizeof(Header));
+	OutData.Append(Image.RawData);
+
+	FImage PreviousMip = MoveTemp(Image);
+	for (int32 MipIndex = 1; MipIndex < NumMips; MipIndex++)
+	{
+		FImage Mip;
+		PreviousMip.ResizeTo(Mip, FMath::Max(PreviousMip.SizeX / 2, 1), FMath::Max(PreviousMip.SizeY / 2, 1), PreviousMip.Format, PreviousMip.GammaSpace);
+		OutData.Append(Mip.RawData);
+		PreviousMip = MoveTemp(Mip);
+	}
+}
+
+bool EncodeTextureImage(IImageWrapperModule& ImageWrapperModule, FImage& Image, int32 TargetSizeX, int32 TargetSizeY, EUEMeshTextureFormat Format, int32 PngCompressionLevel, TArray64<uint8>& OutData)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UEMeshBPExport_EncodeTexture);
+
+	if (Image.SizeX > TargetSizeX || Image.SizeY > TargetSizeY)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(UEMeshBPExport_ResizeTexture);
+
+		FImage Resized;
+		Image.ResizeTo(Resized, TargetSizeX, TargetSizeY, Image.Format, Image.GammaSpace);
+		Image = MoveTemp(Resized);
+	}
+
+	switch (Format)
+	{
+	case EUEMeshTextureFormat::TGA:
+		return ImageWrapperModule.CompressImage(OutData, EImageFormat::TGA, Image);
+	case EUEMeshTextureFormat::EXR:
+		return ImageWrapperModule.CompressImage(OutData, EImageFormat::EXR, Image);
+	case EUEMeshTextureFormat::DDS:
+		EncodeDds(Image, OutData);
+		return true;
+	default:
+		return ImageWrapperModule.CompressImage(OutData, EImageFormat::PNG, Image, FMath::Clamp(PngCompressionLevel, 0, 9));
+	}
+}
+#endif
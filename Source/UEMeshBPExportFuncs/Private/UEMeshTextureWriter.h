@@ -0,0 +1,28 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UEMeshBPExportFuncsTypes.h"
+
+#if WITH_EDITOR
+struct FImage;
+class IImageWrapperModule;
+
+/*
+*	Encoding of exported texture images, shared by every texture format of FUEMeshExportOptions.
+*	Everything here except GetTextureExportMip runs on the thread pool, the source image has been read on the game thread.
+*/
+
+/** File extension written for a texture format, without dot */
+const TCHAR* GetTextureFormatExtension(EUEMeshTextureFormat Format);
+
+/** Mip of a SizeX x SizeY texture that satisfies both TextureMipLevel and MaxTextureSize of Options */
+int32 GetTextureExportMip(int32 SizeX, int32 SizeY, const FUEMeshExportOptions& Options);
+
+/**
+*	Encodes Image into OutData. An image larger than TargetSizeX x TargetSizeY (the source had no stored mip of that size)
+*	is downscaled first. DDS is written uncompressed with a full mip chain generated from the target size down to 1x1.
+*/
+bool EncodeTextureImage(IImageWrapperModule& ImageWrapperModule, FImage& Image, int32 TargetSizeX, int32 TargetSizeY, EUEMeshTextureFormat Format, int32 PngCompressionLevel, TArray64<uint8>& OutData);
+#endif
@@ -0,0 +1,66 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "UEMeshWorkerProcess.h"
+#include "UEMeshBPExportFuncs.h"
+
+#if WITH_EDITOR
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "JsonObjectConverter.h"
+
+FUEMeshWorkerProcess::FUEMeshWorkerProcess(const FString& Directory, const FString& Name)
+	: JobPath(FPaths::Combine(Directory, Name + TEXT(".json")))
+	, ReportPath(FPaths::Combine(Directory, Name + TEXT(".report.json")))
+	, LogPath(FPaths::Combine(Directory, Name + TEXT(".log")))
+{
+}
+
+bool FUEMeshWorkerProcess::Launch(const FUEMeshJob& Job)
+{
+	// A report left by an earlier run must not be taken for the result of this one
+	IFileManager::Get().Delete(*ReportPath, false, true, true);
+
+	FString JobJson;
+	if (!FJsonObjectConverter::UStructToJsonObjectString(Job, JobJson) || !FFileHelper::SaveStringToFile(JobJson, *JobPath))
+	{
+		UE_LOG(LogUEMeshBPExport, Error, TEXT("Failed to write worker job: %s"), *JobPath);
+		return false;
+	}
+
+	const FString ProjectFilePath = FPaths::ConvertRelativePathToFull(FPaths::GetProjectFilePath());
+	const FString WorkerParams = FString::Printf(TEXT("\"%s\" -run=UEMeshBPExport -Job=\"%s\" -Report=\"%s\" -abslog=\"%s\" -nullrhi -unattended -nosplash -nopause -nosound"),
+		*ProjectFilePath, *JobPath, *ReportPath, *LogPath);
+	Process = FPlatformProcess::CreateProc(FPlatformProcess::ExecutablePath(), *WorkerParams, false, true, true, nullptr, 0, nullptr, nullptr);
+	if (!Process.IsValid())
+	{
+		UE_LOG(LogUEMeshBPExport, Error, TEXT("Failed to start worker for %s"), *JobPath);
+		return false;
+	}
+	return true;
+}
+
+int32 FUEMeshWorkerProcess::Wait(FUEMeshJobReport& OutReport)
+{
+	if (!Process.IsValid())
+	{
+		return -1;
+	}
+
+	FPlatformProcess::WaitForProc(Process);
+	int32 ReturnCode = -1;
+	FPlatformProcess::GetProcReturnCode(Process, &ReturnCode);
+	FPlatformProcess::CloseProc(Process);
+
+	FString ReportJson;
+	if (!FFileHelper::LoadFileToString(ReportJson, *ReportPath) || !FJsonObjectConverter::JsonObjectStringToUStruct(ReportJson, &OutReport, 0, 0))
+	{
+		UE_LOG(LogUEMeshBPExport, Warning, TEXT("Worker wrote no report, see %s"), *LogPath);
+	}
+	if (ReturnCode != 0)
+	{
+		UE_LOG(LogUEMeshBPExport, Warning, TEXT("Worker exited with %d, see %s"), ReturnCode, *LogPath);
+	}
+	return ReturnCode;
+}
+#endif
@@ -0,0 +1,29 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/PlatformProcess.h"
+#include "UEMeshBPExportFuncsTypes.h"
+
+#if WITH_EDITOR
+/*
+*	Headless editor processes running the UEMeshBPExport commandlet, used by sharded exports and imports.
+*	Every worker gets <Directory>/<Name>.json as job file and writes <Name>.report.json and <Name>.log next to it.
+*/
+struct FUEMeshWorkerProcess
+{
+	FString JobPath;
+	FString ReportPath;
+	FString LogPath;
+	FProcHandle Process;
+
+	FUEMeshWorkerProcess(const FString& Directory, const FString& Name);
+
+	/** Writes Job and starts the worker on it with the project of this process, false if either failed */
+	bool Launch(const FUEMeshJob& Job);
+
+	/** Waits for the worker to exit, reads its report and returns its exit code, -1 if it never started */
+	int32 Wait(FUEMeshJobReport& OutReport);
+};
+#endif
@@ -4,6 +4,8 @@
 
 #include "Modules/ModuleManager.h"
 
+UEMESHBPEXPORTFUNCS_API DECLARE_LOG_CATEGORY_EXTERN(LogUEMeshBPExport, Log, All);
+
 class FUEMeshBPExportFuncsModule : public IModuleInterface
 {
 public:
@@ -3,6 +3,7 @@
 #pragma once
 
 #include "Kismet/BlueprintFunctionLibrary.h"
+#include "UEMeshBPExportFuncsTypes.h"
 #include "UEMeshBPExportFuncsBPLibrary.generated.h"
 
 /* 
@@ -23,16 +24,64 @@
 *	https://wiki.unrealengine.com/Custom_Blueprint_Node_Creation
 */
 UCLASS()
-class UUEMeshBPExportFuncsBPLibrary : public UBlueprintFunctionLibrary
+class UEMESHBPEXPORTFUNCS_API UUEMeshBPExportFuncsBPLibrary : public UBlueprintFunctionLibrary
 {
 	GENERATED_UCLASS_BODY()
 
 	UFUNCTION(BlueprintCallable, CallInEditor, meta = (DisplayName = "Export Skeletal Meshes", Keywords = "export fbx skeletal mesh"), Category = "UEMeshBPExportFuncs")
 	static bool ExportSkelMeshes(AActor* Actor, const FString& ExportName, const FString& ExportPath);
 	
+	/**
+	 * Exports every actor into ExportPath/<ActorName>.json, sharing exported meshes, materials and textures across the whole batch.
+	 * With Options.NumWorkers above 1 the meshes are exported by that many headless editor processes in parallel.
+	 */
+	UFUNCTION(BlueprintCallable, CallInEditor, meta = (DisplayName = "Export Skeletal Meshes Batch", Keywords = "export fbx skeletal mesh batch", AutoCreateRefTerm = "Options"), Category = "UEMeshBPExportFuncs")
+	static bool ExportSkelMeshesBatch(const TArray<AActor*>& Actors, const FString& ExportPath, const FUEMeshExportOptions& Options, FUEMeshExportStats& OutStats);
+	
 	UFUNCTION(BlueprintCallable, meta = (DisplayName = "List Files", Keywords = "list files directory"), Category = "UEMeshBPExportFuncs")
 	static TArray<FString> ListFiles(const FString& Path, const FString& FilterString, bool bRecursive);
 	
+	/**
+	 * Lists the files below Path whose extension is one of Extensions (e.g. "fbx", "png"; empty matches everything) with their size and time.
+	 * Subdirectories are walked in parallel, listings of unchanged directories are served from a cache, see UEMeshDirectoryScanner.h.
+	 */
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "List Files Ex", Keywords = "list files directory extension size time cache"), Category = "UEMeshBPExportFuncs")
+	static TArray<FUEMeshFileInfo> ListFilesEx(const FString& Path, const TArray<FString>& Extensions, bool bRecursive = true, bool bUseCache = true);
+	
+	/** Drops the directory listings cached by ListFilesEx */
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Clear List Files Cache", Keywords = "list files directory cache"), Category = "UEMeshBPExportFuncs")
+	static void ClearListFilesCache();
+	
+	/**
+	 * SavePolicy saves and unloads the packages the import creates or modifies below TargetUEPath. With EveryNPackages they
+	 * are collected across calls until SaveBatchSize are pending, call SaveImportedPackages after the last import.
+	 * MemoryBudgetMB (0 = off) collects garbage after a mesh once the process uses more, saving the pending packages first.
+	 */
 	UFUNCTION(BlueprintCallable, CallInEditor, meta = (DisplayName = "Import Mesh", Keywords = "import fbx mesh material texture skeleton"), Category = "UEMeshBPExportFuncs")
-	static bool ImportMesh(const FString& TargetUEPath, const FString& SourceFbxPath, const FString& MeshName, bool bImportMaterial, bool bImportSkeleton, UObject* ParentMaterialAsset, float Scale);
+	static bool ImportMesh(const FString& TargetUEPath, const FString& SourceFbxPath, const FString& MeshName, bool bImportMaterial, bool bImportSkeleton, UObject* ParentMaterialAsset, float Scale, EUEMeshImportSavePolicy SavePolicy = EUEMeshImportSavePolicy::None, int32 SaveBatchSize = 100, int32 MemoryBudgetMB = 0);
+	
+	/**
+	 * Imports many FBX files with a single ImportAssetTasks call and returns one result per entry of MeshNames.
+	 * With a SavePolicy the files are imported in chunks of one mesh (PerMesh) or SaveBatchSize meshes, and the packages of
+	 * each chunk are saved and unloaded before the next one, so memory stays bounded on large batches.
+	 * A MemoryBudgetMB above 0 imports one file at a time and behaves as in ImportMesh, OutStats reports the peak memory.
+	 *
+	 * NumWorkers above 1 splits the files over that many headless editor processes running the UEMeshBPExport commandlet.
+	 * Files that would create the same package (a shared texture, or meshes with the same file name) go to the same
+	 * worker. The workers save what they import, at least every SaveBatchSize packages, and the asset registry is
+	 * rescanned once at the end. ParentMaterialAsset has to be saved, the workers load it from disk.
+	 */
+	UFUNCTION(BlueprintCallable, CallInEditor, meta = (DisplayName = "Import Meshes", Keywords = "import fbx mesh material texture skeleton batch"), Category = "UEMeshBPExportFuncs")
+	static TArray<FUEMeshImportResult> ImportMeshes(const FString& TargetUEPath, const FString& SourceFbxPath, const TArray<FString>& MeshNames, bool bImportMaterial, bool bImportSkeleton, UObject* ParentMaterialAsset, float Scale, FUEMeshImportStats& OutStats, EUEMeshImportSavePolicy SavePolicy = EUEMeshImportSavePolicy::None, int32 SaveBatchSize = 100, int32 MemoryBudgetMB = 0, int32 NumWorkers = 0);
+	
+	/**
+	 * Saves and unloads the packages still pending from ImportMesh calls with a save policy or memory budget, returns the
+	 * number saved. OutStats receives the totals of those calls, including peak memory, and they start over.
+	 */
+	UFUNCTION(BlueprintCallable, CallInEditor, meta = (DisplayName = "Save Imported Packages", Keywords = "import save packages memory"), Category = "UEMeshBPExportFuncs")
+	static int32 SaveImportedPackages(FUEMeshImportStats& OutStats);
+	
+	/** Exports and imports a synthetic data set and reports the time of every stage, see UEMeshBenchmark.h */
+	UFUNCTION(BlueprintCallable, CallInEditor, meta = (DisplayName = "Run Export Import Benchmark", Keywords = "benchmark profile export import"), Category = "UEMeshBPExportFuncs")
+	static bool RunBenchmark(const FUEMeshBenchmarkSettings& Settings, FUEMeshBenchmarkReport& OutReport);
 };
@@ -0,0 +1,671 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectPtr.h"
+#include "UEMeshBPExportFuncsTypes.generated.h"
+
+class UAnimSequence;
+
+/*
+*	Option and result structs shared by the export and import entry points of UEMeshBPExportFuncsBPLibrary.
+*	All times are wall-clock seconds.
+*/
+
+/** File format meshes are exported to */
+UENUM(BlueprintType)
+enum class EUEMeshExportFormat : uint8
+{
+	/** Through the FBX exporter, the format ImportMeshes reads */
+	FBX,
+	/** Binary glTF written straight from the render data, much faster than FBX */
+	GLB
+};
+
+/** File format textures are exported to */
+UENUM(BlueprintType)
+enum class EUEMeshTextureFormat : uint8
+{
+	PNG,
+	/** Uncompressed, fast to write and lossless */
+	TGA,
+	/** Floating point, keeps the range of HDR textures */
+	EXR,
+	/** Uncompressed DDS with the full mip chain */
+	DDS
+};
+
+/** When ImportMesh and ImportMeshes save the packages they create or modify */
+UENUM(BlueprintType)
+enum class EUEMeshImportSavePolicy : uint8
+{
+	/** Packages are left dirty in memory, as before */
+	None,
+	/** Saved and unloaded after every mesh and its materials */
+	PerMesh,
+	/** Saved and unloaded whenever SaveBatchSize packages are pending */
+	EveryNPackages
+};
+
+/** Settings of one export run. The defaults match the output of ExportSkelMeshes. */
+USTRUCT(BlueprintType)
+struct FUEMeshExportOptions
+{
+	GENERATED_BODY()
+
+	/** Write actor and material JSON without indentation and line breaks */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "UEMeshBPExportFuncs")
+	bool bCompactJson = false;
+
+	/** Also write every manifest of the export root into one memory-mappable binary file, <ExportPath>/manifest.umbm */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "UEMeshBPExportFuncs")
+	bool bWriteBinaryManifest = false;
+
+	/** Also export the meshes of static and instanced static mesh components, each placement is written as a transform */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "UEMeshBPExportFuncs")
+	bool bExportStaticMeshes = true;
+
+	/** Format of the exported mesh files, the manifests reference whichever was written */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "UEMeshBPExportFuncs")
+	EUEMeshExportFormat MeshFormat = EUEMeshExportFormat::FBX;
+
+	/** Format of the exported texture files */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "UEMeshBPExportFuncs")
+	EUEMeshTextureFormat TextureFormat = EUEMeshTextureFormat::PNG;
+
+	/** Mip written instead of the top mip, 0 is full resolution. Read from the source data when it stores that mip. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "UEMeshBPExportFuncs", meta = (ClampMin = "0"))
+	int32 TextureMipLevel = 0;
+
+	/** Largest width or height written, bigger textures are exported from the first mip that fits. 0 for no limit. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "UEMeshBPExportFuncs", meta = (ClampMin = "0"))
+	int32 MaxTextureSize = 0;
+
+	/** PNG only. 0 is the encoder default, 1 writes uncompressed (fastest), 2-9 trade encode time for size. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "UEMeshBPExportFuncs", meta = (ClampMin = "0", ClampMax = "9"))
+	int32 PngCompressionLevel = 0;
+
+	/**
+	 * Export every LOD of a mesh, not only LOD 0. GLB writes LOD N above 0 into its own <Mesh>_LOD<N>.glb next to the mesh
+	 * file, so a loader can open just the LOD it needs. FBX writes all LODs as an LOD group into the one mesh file.
+	 * The manifests list the LODs with their screen size and vertex and triangle counts.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "UEMeshBPExportFuncs")
+	bool bExportLODs = false;
+
+	/** Export the morph targets of skeletal meshes, into every LOD file that has them */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "UEMeshBPExportFuncs")
+	bool bExportMorphTargets = false;
+
+	/**
+	 * Export the animation sequence each skeletal mesh component plays (single node animation mode) and reference it from
+	 * the actor manifest. Animations and their skeletons are written once per export, see UEMeshAnimationWriter.h.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "UEMeshBPExportFuncs")
+	bool bExportAnimations = false;
+
+	/** Animation sequences exported in addition to those the actors play, listed in <ExportPath>/animations.json */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "UEMeshBPExportFuncs")
+	TArray<TObjectPtr<UAnimSequence>> Animations;
+
+	/**
+	 * Largest error a dropped animation key may introduce, in centimeters for translation, degrees for rotation and
+	 * hundredths for scale. 0 keeps every frame of every animated channel.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "UEMeshBPExportFuncs", meta = (ClampMin = "0"))
+	float AnimationKeyTolerance = 0.0f;
+
+	/** Store animation keys as 16-bit integers instead of floats, translation and scale relative to the range of their channel */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "UEMeshBPExportFuncs")
+	bool bQuantizeAnimations = false;
+
+	/**
+	 * ExportSkelMeshesBatch only. Above 1 the meshes, materials and textures are exported by this many headless editor
+	 * processes on this machine, and this process only writes the manifests. See UEMeshShardedExport.h.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "UEMeshBPExportFuncs", meta = (ClampMin = "0"))
+	int32 NumWorkers = 0;
+};
+
+/** Counters and per-phase timings of one export run (a single actor or a whole batch). */
+USTRUCT(BlueprintType)
+struct FUEMeshExportStats
+{
+	GENERATED_BODY()
+
+	/** Number of actor manifests written */
+	UPROPERTY(BlueprintReadOnly, Category = "UEMeshBPExportFuncs")
+	int32 NumActors = 0;
+
+	/** Number of unique meshes exported */
+	UPROPERTY(BlueprintReadOnly, Category = "UEMeshBPExportFuncs")
+	int32 NumMeshes = 0;
+
+	/** Number of unique material JSON files written */
+	UPROPERTY(BlueprintReadOnly, Category = "UEMeshBPExportFuncs")
+	int32 NumMaterials = 0;
+
+	/** Number of unique textures exported */
+	UPROPERTY(BlueprintReadOnly, Category = "UEMeshBPExportFuncs")
+	int32 NumTextures = 0;
+
+	/** Mesh references resolved from the session cache instead of being exported again */
+	UPROPERTY(BlueprintReadOnly, Category = "UEMeshBPExportFuncs")
+	int32 NumMeshesReused = 0;
+
+	/** Material references resolved from the session cache instead of being exported again */
+	UPROPERTY(BlueprintReadOnly, Category = "UEMeshBPExportFuncs")
+	int32 NumMaterialsReused = 0;
+
+	/** Texture references resolved from the session cache instead of being exported again */
+	UPROPERTY(BlueprintReadOnly, Category = "UEMeshBPExportFuncs")
+	int32 NumTexturesReused = 0;
+
+	/** Textures not written because another texture of the export has the same content, they reference its file */
+	UPROPERTY(BlueprintReadOnly, Category = "UEMeshBPExportFuncs")
+	int32 NumTexturesDeduplicated = 0;
+
+	/** Meshes, materials and textures skipped because the export state cache showed them unchanged (cache hits) */
+	UPROPERTY(BlueprintReadOnly, Category = "UEMeshBPExportFuncs")
+	int32 NumUpToDate = 0;
+
+	/** Meshes, materials and textures the export state cache did not have or had with a different source (cache misses) */
+	UPROPERTY(BlueprintReadOnly, Category = "UEMeshBPExportFuncs")
+	int32 NumCacheMisses = 0;
+
+	/** Total size of all files written, including manifests */
+	UPROPERTY(BlueprintReadOnly, Category = "UEMeshBPExportFuncs")
+	int64 BytesWritten = 0;
+
+	/** Time spent writing mesh files */
+	UPROPERTY(BlueprintReadOnly, Category = "UEMeshBPExportFuncs")
+	double MeshExportSeconds = 0.0;
+
+	/** Time spent collecting material parameters and writing material JSON, excluding texture export */
+	UPROPERTY(BlueprintReadOnly, Category = "UEMeshBPExportFuncs")
+	double MaterialExportSeconds = 0.0;
+
+	/** Game thread time spent reading texture source data and waiting for the asynchronous texture writes */
+	UPROPERTY(BlueprintReadOnly, Category = "UEMeshBPExportFuncs")
+	double TextureExportSeconds = 0.0;
+
+	/** Number of unique animation sequences exported */
+	UPROPERTY(BlueprintReadOnly, Category = "UEMeshBPExportFuncs")
+	int32 NumAnimations = 0;
+
+	/** Number of unique skeletons written, shared by all meshes and animations that use them */
+	UPROPERTY(BlueprintReadOnly, Category = "UEMeshBPExportFuncs")
+	int32 NumSkeletons = 0;
+
+	/** Time spent sampling, reducing and writing animations and skeletons */
+	UPROPERTY(BlueprintReadOnly, Category = "UEMeshBPExportFuncs")
+	double AnimationExportSeconds = 0.0;
+
+	/** Time spent writing actor manifests */
+	UPROPERTY(BlueprintReadOnly, Category = "UEMeshBPExportFuncs")
+	double ManifestWriteSeconds = 0.0;
+
+	/** Worker processes of a sharded export, 0 if it ran in process. Counters and phase times include the workers. */
+	UPROPERTY(BlueprintReadOnly, Category = "UEMeshBPExportFuncs")
+	int32 NumWorkers = 0;
+
+	/** Wall-clock time until the last worker of a sharded export finished */
+	UPROPERTY(BlueprintReadOnly, Category = "UEMeshBPExportFuncs")
+	double WorkerSeconds = 0.0;
+
+	/** Wall-clock time of the whole run */
+	UPROPERTY(BlueprintReadOnly, Category = "UEMeshBPExportFuncs")
+	double TotalSeconds = 0.0;
+};
+
+/** File found by ListFilesEx */
+USTRUCT(BlueprintType)
+struct FUEMeshFileInfo
+{
+	GENERATED_BODY()
+
+	/** Full path of the file */
+	UPROPERTY(BlueprintReadOnly, Category = "UEMeshBPExportFuncs")
+	FString Path;
+
+	UPROPERTY(BlueprintReadOnly, Category = "UEMeshBPExportFuncs")
+	int64 Size = 0;
+
+	/** Last modification time (UTC) */
+	UPROPERTY(BlueprintReadOnly, Category = "UEMeshBPExportFuncs")
+	FDateTime ModificationTime;
+};
+
+/** Outcome of one file imported by ImportMeshes */
+USTRUCT(BlueprintType)
+struct FUEMeshImportResult
+{
+	GENERATED_BODY()
+
+	/** Entry of MeshNames this result belongs to */
+	UPROPERTY(BlueprintReadOnly, Category = "UEMeshBPExportFuncs")
+	FString MeshName;
+
+	UPROPERTY(BlueprintReadOnly, Category = "UEMeshBPExportFuncs")
+	bool bSuccess = false;
+
+	/** Object paths of the assets created from the file */
+	UPROPERTY(BlueprintReadOnly, Category = "UEMeshBPExportFuncs")
+	TArray<FString> ImportedObjectPaths;
+
+	/** Share of the batched import spent on this file, measured between post import notifications */
+	UPROPERTY(BlueprintReadOnly, Category = "UEMeshBPExportFuncs")
+	double ImportSeconds = 0.0;
+
+	/** Time spent importing textures and binding material instances from the material JSON */
+	UPROPERTY(BlueprintReadOnly, Category = "UEMeshBPExportFuncs")
+	double MaterialSeconds = 0.0;
+};
+
+/** Counters and per-stage timings of one ImportMeshes call */
+USTRUCT(BlueprintType)
+struct FUEMeshImportStats
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "UEMeshBPExportFuncs")
+	int32 NumFilesImported = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "UEMeshBPExportFuncs")
+	int32 NumFilesFailed = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "UEMeshBPExportFuncs")
+	int32 NumTexturesImported = 0;
+
+	/** Texture references resolved to a texture imported earlier */
+	UPROPERTY(BlueprintReadOnly, Category = "UEMeshBPExportFuncs")
+	int32 NumTexturesReused = 0;
+
+	/** Texture files resolved to a texture imported from identical bytes under another path, see the texture hash index */
+	UPROPERTY(BlueprintReadOnly, Category = "UEMeshBPExportFuncs")
+	int32 NumTexturesDeduplicated = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "UEMeshBPExportFuncs")
+	int32 NumMaterialInstancesCreated = 0;
+
+	/** Material instances that already existed and were only updated */
+	UPROPERTY(BlueprintReadOnly, Category = "UEMeshBPExportFuncs")
+	int32 NumMaterialInstancesReused = 0;
+
+	/** Material manifests served from the parsed manifest cache */
+	UPROPERTY(BlueprintReadOnly, Category = "UEMeshBPExportFuncs")
+	int32 NumManifestCacheHits = 0;
+
+	/** Material manifests read and parsed from disk */
+	UPROPERTY(BlueprintReadOnly, Category = "UEMeshBPExportFuncs")
+	int32 NumManifestCacheMisses = 0;
+
+	/** Total size of the texture files read */
+	UPROPERTY(BlueprintReadOnly, Category = "UEMeshBPExportFuncs")
+	int64 BytesRead = 0;
+
+	/** Time spent inside the FBX import */
+	UPROPERTY(BlueprintReadOnly, Category = "UEMeshBPExportFuncs")
+	double MeshImportSeconds = 0.0;
+
+	/** Time spent reading and hashing texture files on worker threads */
+	UPROPERTY(BlueprintReadOnly, Category = "UEMeshBPExportFuncs")
+	double TexturePrefetchSeconds = 0.0;
+
+	/** Time spent creating texture assets */
+	UPROPERTY(BlueprintReadOnly, Category = "UEMeshBPExportFuncs")
+	double TextureImportSeconds = 0.0;
+
+	/** Time spent in the deferred texture, material instance and mesh rebuilds */
+	UPROPERTY(BlueprintReadOnly, Category = "UEMeshBPExportFuncs")
+	double RebuildSeconds = 0.0;
+
+	/** Time spent binding materials, including texture prefetch, import and rebuilds */
+	UPROPERTY(BlueprintReadOnly, Category = "UEMeshBPExportFuncs")
+	double MaterialSeconds = 0.0;
+
+	/** Packages written by the save policy */
+	UPROPERTY(BlueprintReadOnly, Category = "UEMeshBPExportFuncs")
+	int32 NumPackagesSaved = 0;
+
+	/** Time spent saving and unloading packages for the save policy, including garbage collection */
+	UPROPERTY(BlueprintReadOnly, Category = "UEMeshBPExportFuncs")
+	double SaveSeconds = 0.0;
+
+	/** Garbage collections run because the memory budget was exceeded */
+	UPROPERTY(BlueprintReadOnly, Category = "UEMeshBPExportFuncs")
+	int32 NumGarbageCollections = 0;
+
+	/** Highest resident memory of the process in MiB, sampled after every mesh */
+	UPROPERTY(BlueprintReadOnly, Category = "UEMeshBPExportFuncs")
+	double PeakMemoryMB = 0.0;
+
+	/** Worker processes of a sharded import, 0 if it ran in process. Counters and stage times are summed over the workers. */
+	UPROPERTY(BlueprintReadOnly, Category = "UEMeshBPExportFuncs")
+	int32 NumWorkers = 0;
+
+	/** Wall-clock time until the last worker of a sharded import finished */
+	UPROPERTY(BlueprintReadOnly, Category = "UEMeshBPExportFuncs")
+	double WorkerSeconds = 0.0;
+
+	/** Wall-clock time of the whole call */
+	UPROPERTY(BlueprintReadOnly, Category = "UEMeshBPExportFuncs")
+	double TotalSeconds = 0.0;
+};
+
+/** Size of the synthetic data set generated by RunBenchmark */
+USTRUCT(BlueprintType)
+struct FUEMeshBenchmarkSettings
+{
+	GENERATED_BODY()
+
+	/** Number of actors exported, each references one of the synthetic meshes */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "UEMeshBPExportFuncs", meta = (ClampMin = "1"))
+	int32 NumActors = 32;
+
+	/** Number of unique skeletal meshes, duplicated from the engine skeletal cube */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "UEMeshBPExportFuncs", meta = (ClampMin = "1"))
+	int32 NumMeshes = 16;
+
+	/** Number of unique material instances, assigned to the meshes round robin */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "UEMeshBPExportFuncs", meta = (ClampMin = "1"))
+	int32 NumMaterials = 8;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "UEMeshBPExportFuncs", meta = (ClampMin = "0"))
+	int32 NumScalarParameters = 32;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "UEMeshBPExportFuncs", meta = (ClampMin = "0"))
+	int32 NumVectorParameters = 16;
+
+	/** Texture parameters per material, the first four are the ones ImportMesh binds */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "UEMeshBPExportFuncs", meta = (ClampMin = "0"))
+	int32 NumTextureParameters = 4;
+
+	/** Number of unique textures, assigned to the texture parameters round robin */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "UEMeshBPExportFuncs", meta = (ClampMin = "1"))
+	int32 NumTextures = 16;
+
+	/** Width and height of the synthetic textures */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "UEMeshBPExportFuncs", meta = (ClampMin = "4"))
+	int32 TextureSize = 512;
+
+	/** Instances of the engine cube every actor places with an instanced static mesh component, 0 exports skeletal meshes only */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "UEMeshBPExportFuncs", meta = (ClampMin = "0"))
+	int32 NumStaticMeshInstances = 0;
+
+	/** Import the exported files again and bind their materials */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "UEMeshBPExportFuncs")
+	bool bImport = true;
+
+	/** Keep the exported files instead of deleting them after the run */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "UEMeshBPExportFuncs")
+	bool bKeepFiles = false;
+
+	/** Where the run writes its files and report, defaults to <Project>/Saved/UEMeshBenchmark/<Timestamp> */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "UEMeshBPExportFuncs")
+	FString OutputDirectory;
+};
+
+/** Per-stage measurements of one RunBenchmark call */
+USTRUCT(BlueprintType)
+struct FUEMeshBenchmarkReport
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "UEMeshBPExportFuncs")
+	FUEMeshBenchmarkSettings Settings;
+
+	/** Time spent generating the synthetic assets, not part of any other stage */
+	UPROPERTY(BlueprintReadOnly, Category = "UEMeshBPExportFuncs")
+	double SetupSeconds = 0.0;
+
+	/** Wall-clock time of the export, broken down in ExportStats */
+	UPROPERTY(BlueprintReadOnly, Category = "UEMeshBPExportFuncs")
+	double ExportSeconds = 0.0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "UEMeshBPExportFuncs")
+	FUEMeshExportStats ExportStats;
+
+	UPROPERTY(BlueprintReadOnly, Category = "UEMeshBPExportFuncs")
+	FUEMeshImportStats ImportStats;
+
+	/** Wall-clock time of ImportMeshes, including material binding */
+	UPROPERTY(BlueprintReadOnly, Category = "UEMeshBPExportFuncs")
+	double ImportSeconds = 0.0;
+
+	/** Sum of the FBX import time of all files */
+	UPROPERTY(BlueprintReadOnly, Category = "UEMeshBPExportFuncs")
+	double MeshImportSeconds = 0.0;
+
+	/** Sum of the texture import and material binding time of all files */
+	UPROPERTY(BlueprintReadOnly, Category = "UEMeshBPExportFuncs")
+	double MaterialBindingSeconds = 0.0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "UEMeshBPExportFuncs")
+	int32 NumFilesWritten = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "UEMeshBPExportFuncs")
+	int64 BytesWritten = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "UEMeshBPExportFuncs")
+	int32 NumFilesImported = 0;
+
+	/** Change of the process memory use over the export, in MiB */
+	UPROPERTY(BlueprintReadOnly, Category = "UEMeshBPExportFuncs")
+	double ExportMemoryDeltaMB = 0.0;
+
+	/** Change of the process memory use over the import, in MiB */
+	UPROPERTY(BlueprintReadOnly, Category = "UEMeshBPExportFuncs")
+	double ImportMemoryDeltaMB = 0.0;
+
+	/** Peak memory use of the process at the end of the run, in MiB */
+	UPROPERTY(BlueprintReadOnly, Category = "UEMeshBPExportFuncs")
+	double PeakMemoryMB = 0.0;
+};
+
+/** Export entry of a UEMeshBPExport commandlet job file: actors of one map exported like ExportSkelMeshesBatch */
+USTRUCT(BlueprintType)
+struct FUEMeshExportJob
+{
+	GENERATED_BODY()
+
+	/** Long package name of the map to load, e.g. /Game/Maps/Characters */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "UEMeshBPExportFuncs")
+	FString Map;
+
+	/** Names or labels of the actors to export, empty exports every actor with a skeletal or static mesh component */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "UEMeshBPExportFuncs")
+	TArray<FString> Actors;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "UEMeshBPExportFuncs")
+	FString ExportPath;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "UEMeshBPExportFuncs")
+	FUEMeshExportOptions Options;
+};
+
+/** Import entry of a UEMeshBPExport commandlet job file: FBX files of one directory imported like ImportMeshes */
+USTRUCT(BlueprintType)
+struct FUEMeshImportJob
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "UEMeshBPExportFuncs")
+	FString SourceDirectory;
+
+	/** Files relative to SourceDirectory, empty imports every .fbx below it */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "UEMeshBPExportFuncs")
+	TArray<FString> Files;
+
+	/** Content path the assets are created in, e.g. /Game/Imported */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "UEMeshBPExportFuncs")
+	FString TargetPath;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "UEMeshBPExportFuncs")
+	bool bImportMaterial = true;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "UEMeshBPExportFuncs")
+	bool bImportSkeleton = true;
+
+	/** Object path of the parent material of the created material instances, required with bImportMaterial */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "UEMeshBPExportFuncs")
+	FString ParentMaterial;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "UEMeshBPExportFuncs")
+	float Scale = 1.0f;
+
+	/** Saving is on by default, an unattended run that leaves its packages dirty imports nothing */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "UEMeshBPExportFuncs")
+	EUEMeshImportSavePolicy SavePolicy = EUEMeshImportSavePolicy::EveryNPackages;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "UEMeshBPExportFuncs", meta = (ClampMin = "1"))
+	int32 SaveBatchSize = 100;
+
+	/** See ImportMeshes, 0 = off */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "UEMeshBPExportFuncs", meta = (ClampMin = "0"))
+	int32 MemoryBudgetMB = 0;
+
+	/** See ImportMeshes, above 1 the files are imported by that many further commandlet processes */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "UEMeshBPExportFuncs", meta = (ClampMin = "0"))
+	int32 NumWorkers = 0;
+
+	/** Set by sharded imports for their workers: file receiving the texture hash index entries the worker added */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "UEMeshBPExportFuncs")
+	FString TextureHashIndexChangesFile;
+};
+
+/** Meshes exported by one worker process of a sharded export, written by the coordinating process */
+USTRUCT(BlueprintType)
+struct FUEMeshExportShardJob
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "UEMeshBPExportFuncs")
+	FString ExportPath;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "UEMeshBPExportFuncs")
+	FUEMeshExportOptions Options;
+
+	/** Object paths of the skeletal and static meshes to export with their materials and textures */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "UEMeshBPExportFuncs")
+	TArray<FString> Meshes;
+
+	/** File receiving the export state recorded by the worker, merged into the export root by the coordinator */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "UEMeshBPExportFuncs")
+	FString StateChangesFile;
+};
+
+/** Job file read by the UEMeshBPExport commandlet, exports run before imports */
+USTRUCT(BlueprintType)
+struct FUEMeshJob
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "UEMeshBPExportFuncs")
+	TArray<FUEMeshExportJob> Exports;
+
+	/** Written by sharded exports for their workers, see UEMeshShardedExport.h */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "UEMeshBPExportFuncs")
+	TArray<FUEMeshExportShardJob> ExportShards;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "UEMeshBPExportFuncs")
+	TArray<FUEMeshImportJob> Imports;
+};
+
+/** Outcome of one FUEMeshExportJob */
+USTRUCT(BlueprintType)
+struct FUEMeshExportJobResult
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "UEMeshBPExportFuncs")
+	FString Map;
+
+	UPROPERTY(BlueprintReadOnly, Category = "UEMeshBPExportFuncs")
+	FString ExportPath;
+
+	UPROPERTY(BlueprintReadOnly, Category = "UEMeshBPExportFuncs")
+	bool bSuccess = false;
+
+	/** Requested actors that are not in the map */
+	UPROPERTY(BlueprintReadOnly, Category = "UEMeshBPExportFuncs")
+	TArray<FString> MissingActors;
+
+	UPROPERTY(BlueprintReadOnly, Category = "UEMeshBPExportFuncs")
+	int32 NumActorsExported = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "UEMeshBPExportFuncs")
+	FUEMeshExportStats Stats;
+};
+
+/** Outcome of one FUEMeshExportShardJob */
+USTRUCT(BlueprintType)
+struct FUEMeshExportShardResult
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "UEMeshBPExportFuncs")
+	bool bSuccess = false;
+
+	/** Meshes of the shard that could not be loaded or exported */
+	UPROPERTY(BlueprintReadOnly, Category = "UEMeshBPExportFuncs")
+	TArray<FString> FailedMeshes;
+
+	UPROPERTY(BlueprintReadOnly, Category = "UEMeshBPExportFuncs")
+	FUEMeshExportStats Stats;
+};
+
+/** Outcome of one FUEMeshImportJob */
+USTRUCT(BlueprintType)
+struct FUEMeshImportJobResult
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "UEMeshBPExportFuncs")
+	FString SourceDirectory;
+
+	UPROPERTY(BlueprintReadOnly, Category = "UEMeshBPExportFuncs")
+	FString TargetPath;
+
+	UPROPERTY(BlueprintReadOnly, Category = "UEMeshBPExportFuncs")
+	bool bSuccess = false;
+
+	/** Files of the job that created no asset */
+	UPROPERTY(BlueprintReadOnly, Category = "UEMeshBPExportFuncs")
+	TArray<FString> FailedFiles;
+
+	/** One entry per file, as returned by ImportMeshes */
+	UPROPERTY(BlueprintReadOnly, Category = "UEMeshBPExportFuncs")
+	TArray<FUEMeshImportResult> Results;
+
+	UPROPERTY(BlueprintReadOnly, Category = "UEMeshBPExportFuncs")
+	FUEMeshImportStats Stats;
+};
+
+/** Report written by the UEMeshBPExport commandlet */
+USTRUCT(BlueprintType)
+struct FUEMeshJobReport
+{
+	GENERATED_BODY()
+
+	/** Job file the report belongs to */
+	UPROPERTY(BlueprintReadOnly, Category = "UEMeshBPExportFuncs")
+	FString Job;
+
+	/** True if every export and import job succeeded, the commandlet then exits with 0 */
+	UPROPERTY(BlueprintReadOnly, Category = "UEMeshBPExportFuncs")
+	bool bSuccess = false;
+
+	UPROPERTY(BlueprintReadOnly, Category = "UEMeshBPExportFuncs")
+	TArray<FUEMeshExportJobResult> Exports;
+
+	UPROPERTY(BlueprintReadOnly, Category = "UEMeshBPExportFuncs")
+	TArray<FUEMeshExportShardResult> ExportShards;
+
+	UPROPERTY(BlueprintReadOnly, Category = "UEMeshBPExportFuncs")
+	TArray<FUEMeshImportJobResult> Imports;
+
+	UPROPERTY(BlueprintReadOnly, Category = "UEMeshBPExportFuncs")
+	double TotalSeconds = 0.0;
+};
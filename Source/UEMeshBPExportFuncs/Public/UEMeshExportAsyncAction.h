@@ -0,0 +1,92 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "Engine/CancellableAsyncAction.h"
+#include "Containers/Ticker.h"
+#include "UEMeshBPExportFuncsTypes.h"
+#include "UEMeshExportAsyncAction.generated.h"
+
+class AActor;
+class FUEMeshExportSession;
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FUEMeshExportAsyncDelegate, float, Progress, bool, bSuccess, const FUEMeshExportStats&, Stats);
+
+/*
+*	Non-blocking version of ExportSkelMeshesBatch.
+*	The export is split into work items (collect actor meshes, skeletal or static mesh file, material JSON, actor manifest) that run on the
+*	game thread for at most TimeSliceMs per frame, while the encoding and writing of textures runs on the thread pool.
+*	Cancelling stops after the current work item. Outputs finished so far are recorded in the export state cache,
+*	so running the same export again only writes what is still missing.
+*/
+UCLASS()
+class UEMESHBPEXPORTFUNCS_API UUEMeshExportAsyncAction : public UCancellableAsyncAction
+{
+	GENERATED_BODY()
+
+public:
+	/** Exports every actor into ExportPath/<ActorName>.json like ExportSkelMeshesBatch, spread over several frames */
+	UFUNCTION(BlueprintCallable, meta = (BlueprintInternalUseOnly = "true", DisplayName = "Export Skeletal Meshes Async", Keywords = "export fbx skeletal mesh batch async latent", AutoCreateRefTerm = "Options"), Category = "UEMeshBPExportFuncs")
+	static UUEMeshExportAsyncAction* ExportSkelMeshesAsync(const TArray<AActor*>& Actors, const FString& ExportPath, const FUEMeshExportOptions& Options, float TimeSliceMs = 10.0f);
+
+	/** Fired at most once per frame while work items are processed */
+	UPROPERTY(BlueprintAssignable)
+	FUEMeshExportAsyncDelegate OnProgress;
+
+	/** Fired once every actor is exported, bSuccess is false if any actor failed */
+	UPROPERTY(BlueprintAssignable)
+	FUEMeshExportAsyncDelegate OnCompleted;
+
+	/** Fired instead of OnCompleted when the export was cancelled */
+	UPROPERTY(BlueprintAssignable)
+	FUEMeshExportAsyncDelegate OnCancelled;
+
+	virtual void Activate() override;
+	virtual void Cancel() override;
+	virtual bool IsActive() const override;
+
+private:
+	enum class EWorkItemType : uint8
+	{
+		CollectActor,
+		ExportMesh,
+		ExportMaterial,
+		FinishMesh,
+		WriteManifest,
+		ExportAnimation,
+	};
+
+	struct FWorkItem
+	{
+		EWorkItemType Type;
+		int32 ActorIndex = INDEX_NONE;
+		UObject* Asset = nullptr;
+	};
+
+	bool Tick(float DeltaTime);
+
+	/** Runs one work item, returns false if it has to be retried on a later frame */
+	bool ProcessWorkItem(const FWorkItem& WorkItem);
+
+	/** Closes the session and fires OnCompleted or OnCancelled */
+	void FinishExport(bool bCancelled);
+
+	TArray<TWeakObjectPtr<AActor>> Actors;
+	FString ExportPath;
+	FUEMeshExportOptions Options;
+	double TimeSliceSeconds = 0.01;
+
+	TSharedPtr<FUEMeshExportSession> Session;
+	TArray<FWorkItem> WorkItems;
+	int32 NextWorkItem = 0;
+
+	/** Keeps the meshes and materials referenced by pending work items alive */
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<UObject>> ReferencedAssets;
+
+	FTSTicker::FDelegateHandle TickerHandle;
+	float Progress = 0.0f;
+	bool bAllSucceeded = true;
+	bool bCancelRequested = false;
+	bool bRunning = false;
+};
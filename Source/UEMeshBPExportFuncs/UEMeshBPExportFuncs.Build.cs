@@ -40,10 +40,13 @@ public class UEMeshBPExportFuncs : ModuleRules
 				"SlateCore",
 				"UnrealEd",
 				"AssetTools",
+				"MaterialEditor",
 				"ImageWriteQueue",
 				"ImageWrapper",
+				"ImageCore",
 				"Json",
 				"JsonUtilities",
+				"RenderCore",
 				// ... add private dependencies that you statically link with here ...	
 			}
 			);
@@ -0,0 +1,7 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Modules/ModuleManager.h"
+
+// Editor-only module holding the automation tests of the plugin, run with e.g.
+// UnrealEditor-Cmd <Project> -nullrhi -unattended -ExecCmds="Automation RunTests UEMeshBPExport;Quit"
+IMPLEMENT_MODULE(FDefaultModuleImpl, UEMeshBPExportFuncsTests)
@@ -0,0 +1,63 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/Parse.h"
+#include "UEMeshBPExportFuncsBPLibrary.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+/*
+*	Export/import benchmark on synthetic assets as an automation test, one test per data set size below.
+*	Each run appends its measurements to <Project>/Saved/UEMeshBenchmark/Results.csv, see UEMeshBenchmark.h in the runtime module.
+*	The test fails if the export or the import of any mesh fails.
+*/
+IMPLEMENT_COMPLEX_AUTOMATION_TEST(FUEMeshBenchmarkTest, "UEMeshBPExport.Benchmark", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+void FUEMeshBenchmarkTest::GetTests(TArray<FString>& OutBeautifiedNames, TArray<FString>& OutTestCommands) const
+{
+	// Parameters are Key=Value pairs named like the arguments of the UEMeshBPExport.Benchmark console command
+	OutBeautifiedNames.Add(TEXT("Small"));
+	OutTestCommands.Add(TEXT("Actors=4 Meshes=4 Materials=2 Textures=4 TextureSize=256"));
+
+	OutBeautifiedNames.Add(TEXT("Default"));
+	OutTestCommands.Add(FString());
+
+	OutBeautifiedNames.Add(TEXT("ManyParameters"));
+	OutTestCommands.Add(TEXT("Meshes=8 Materials=8 Scalars=128 Vectors=64 TextureParams=8"));
+
+	OutBeautifiedNames.Add(TEXT("LargeTextures"));
+	OutTestCommands.Add(TEXT("Actors=8 Meshes=4 Materials=4 Textures=8 TextureSize=2048"));
+
+	OutBeautifiedNames.Add(TEXT("StaticMeshInstances"));
+	OutTestCommands.Add(TEXT("Actors=8 Meshes=4 Materials=2 Textures=4 Instances=1024"));
+}
+
+bool FUEMeshBenchmarkTest::RunTest(const FString& Parameters)
+{
+	FUEMeshBenchmarkSettings Settings;
+	FParse::Value(*Parameters, TEXT("Actors="), Settings.NumActors);
+	FParse::Value(*Parameters, TEXT("Meshes="), Settings.NumMeshes);
+	FParse::Value(*Parameters, TEXT("Materials="), Settings.NumMaterials);
+	FParse::Value(*Parameters, TEXT("Scalars="), Settings.NumScalarParameters);
+	FParse::Value(*Parameters, TEXT("Vectors="), Settings.NumVectorParameters);
+	FParse::Value(*Parameters, TEXT("TextureParams="), Settings.NumTextureParameters);
+	FParse::Value(*Parameters, TEXT("Textures="), Settings.NumTextures);
+	FParse::Value(*Parameters, TEXT("TextureSize="), Settings.TextureSize);
+	FParse::Value(*Parameters, TEXT("Instances="), Settings.NumStaticMeshInstances);
+
+	FUEMeshBenchmarkReport Report;
+	const bool bSucceeded = UUEMeshBPExportFuncsBPLibrary::RunBenchmark(Settings, Report);
+
+	TestTrue(TEXT("Export wrote files"), Report.NumFilesWritten > 0);
+	TestEqual(TEXT("Imported mesh files"), Report.NumFilesImported, Report.Settings.NumMeshes);
+	TestTrue(TEXT("Benchmark succeeded"), bSucceeded);
+
+	AddInfo(FString::Printf(TEXT("Setup %.2fs, Export %.2fs (%d files, %lld bytes), Import %.2fs (mesh %.2fs, material %.2fs), peak memory %.1f MB"),
+		Report.SetupSeconds, Report.ExportSeconds, Report.NumFilesWritten, Report.BytesWritten,
+		Report.ImportSeconds, Report.MeshImportSeconds, Report.MaterialBindingSeconds, Report.PeakMemoryMB));
+
+	return bSucceeded;
+}
+
+#endif
@@ -0,0 +1,104 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "UEMeshBPExportFuncsBPLibrary.h"
+#include "Animation/SkeletalMeshActor.h"
+#include "Components/ChildActorComponent.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "Components/StaticMeshComponent.h"
+#include "Engine/SkeletalMesh.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/StaticMeshActor.h"
+#include "Engine/World.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+/*
+*	Exports an actor whose meshes are spread over a child actor component and an attached actor, and checks that the
+*	actor manifest lists all of them.
+*/
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FUEMeshExportHierarchyTest, "UEMeshBPExport.Export.ActorHierarchy", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FUEMeshExportHierarchyTest::RunTest(const FString& Parameters)
+{
+	USkeletalMesh* SkeletalMesh = LoadObject<USkeletalMesh>(nullptr, TEXT("/Engine/EngineMeshes/SkeletalCube.SkeletalCube"));
+	UStaticMesh* RootMesh = LoadObject<UStaticMesh>(nullptr, TEXT("/Engine/BasicShapes/Cube.Cube"));
+	UStaticMesh* ChildMesh = LoadObject<UStaticMesh>(nullptr, TEXT("/Engine/BasicShapes/Sphere.Sphere"));
+	if (!TestNotNull(TEXT("Skeletal cube"), SkeletalMesh) || !TestNotNull(TEXT("Cube"), RootMesh) || !TestNotNull(TEXT("Sphere"), ChildMesh))
+	{
+		return false;
+	}
+
+	UWorld* World = UWorld::CreateWorld(EWorldType::Inactive, false);
+	World->AddToRoot();
+
+	FActorSpawnParameters SpawnParameters;
+	SpawnParameters.ObjectFlags = RF_Transient;
+
+	// Root actor with a static mesh of its own and a child actor placing another one
+	AStaticMeshActor* RootActor = World->SpawnActor<AStaticMeshActor>(SpawnParameters);
+	RootActor->GetStaticMeshComponent()->SetStaticMesh(RootMesh);
+
+	UChildActorComponent* ChildActorComponent = NewObject<UChildActorComponent>(RootActor, TEXT("HierarchyChild"), RF_Transient);
+	ChildActorComponent->SetChildActorClass(AStaticMeshActor::StaticClass());
+	ChildActorComponent->SetupAttachment(RootActor->GetRootComponent());
+	ChildActorComponent->RegisterComponent();
+	AStaticMeshActor* ChildActor = Cast<AStaticMeshActor>(ChildActorComponent->GetChildActor());
+	if (TestNotNull(TEXT("Child actor"), ChildActor))
+	{
+		ChildActor->GetStaticMeshComponent()->SetStaticMesh(ChildMesh);
+	}
+
+	// Separate actor attached to the root, only reachable through the attachment
+	ASkeletalMeshActor* AttachedActor = World->SpawnActor<ASkeletalMeshActor>(SpawnParameters);
+	AttachedActor->GetSkeletalMeshComponent()->SetSkeletalMeshAsset(SkeletalMesh);
+	AttachedActor->AttachToActor(RootActor, FAttachmentTransformRules::KeepRelativeTransform);
+
+	const FString ExportDirectory = FPaths::ProjectSavedDir() / TEXT("UEMeshBPExportTests") / TEXT("ActorHierarchy");
+	IFileManager::Get().DeleteDirectory(*ExportDirectory, false, true);
+
+	FUEMeshExportOptions Options;
+	Options.bExportStaticMeshes = true;
+	FUEMeshExportStats Stats;
+	const bool bExported = UUEMeshBPExportFuncsBPLibrary::ExportSkelMeshesBatch({ RootActor }, ExportDirectory, Options, Stats);
+	TestTrue(TEXT("Export succeeded"), bExported);
+
+	FString ManifestString;
+	TSharedPtr<FJsonObject> Manifest;
+	if (TestTrue(TEXT("Actor manifest written"), FFileHelper::LoadFileToString(ManifestString, *(ExportDirectory / RootActor->GetName() + TEXT(".json"))))
+		&& TestTrue(TEXT("Actor manifest parses"), FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(ManifestString), Manifest) && Manifest.IsValid()))
+	{
+		TArray<FString> MeshAssetPaths;
+		for (const TCHAR* FieldName : { TEXT("SkeletalMeshes"), TEXT("StaticMeshes") })
+		{
+			const TArray<TSharedPtr<FJsonValue>>* MeshesJson = nullptr;
+			if (Manifest->TryGetArrayField(FieldName, MeshesJson))
+			{
+				for (const TSharedPtr<FJsonValue>& MeshJson : *MeshesJson)
+				{
+					MeshAssetPaths.Add(MeshJson->AsObject()->GetStringField(TEXT("MeshAssetPath")));
+				}
+			}
+		}
+
+		TestTrue(TEXT("Static mesh of the root actor exported"), MeshAssetPaths.Contains(RootMesh->GetPathName()));
+		TestTrue(TEXT("Static mesh of the child actor exported"), MeshAssetPaths.Contains(ChildMesh->GetPathName()));
+		TestTrue(TEXT("Skeletal mesh of the attached actor exported"), MeshAssetPaths.Contains(SkeletalMesh->GetPathName()));
+		TestEqual(TEXT("Meshes in the actor manifest"), MeshAssetPaths.Num(), 3);
+	}
+
+	World->DestroyWorld(false);
+	World->RemoveFromRoot();
+	IFileManager::Get().DeleteDirectory(*ExportDirectory, false, true);
+
+	return true;
+}
+
+#endif
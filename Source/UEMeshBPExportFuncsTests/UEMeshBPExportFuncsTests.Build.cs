@@ -0,0 +1,22 @@
+// Some copyright should be here...
+
+using UnrealBuildTool;
+
+public class UEMeshBPExportFuncsTests : ModuleRules
+{
+	public UEMeshBPExportFuncsTests(ReadOnlyTargetRules Target) : base(Target)
+	{
+		PCHUsage = ModuleRules.PCHUsageMode.UseExplicitOrSharedPCHs;
+		
+		PrivateDependencyModuleNames.AddRange(
+			new string[]
+			{
+				"Core",
+				"CoreUObject",
+				"Engine",
+				"Json",
+				"UEMeshBPExportFuncs",
+			}
+			);
+	}
+}